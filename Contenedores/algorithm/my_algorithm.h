@@ -1,6 +1,13 @@
 #ifndef MY_ALGORITHM_H
 #define MY_ALGORITHM_H
 
+#include "my_simd.h"
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <type_traits>
 #include <utility>
 
 namespace mySTL
@@ -31,6 +38,30 @@ namespace mySTL
 		}
 	}
 
+	/**
+	 * Indica si copiar elementos de @a InputIterator a @a OutputIterator equivale a copiar
+	 * sus bytes: ambos son punteros al mismo tipo, y ese tipo se copia trivialmente. En ese
+	 * caso, copy, copy_n y copy_backward hacen una sola llamada a memmove en lugar de
+	 * copiar elemento por elemento.
+	 */
+	template <typename InputIterator, typename OutputIterator>
+	constexpr bool is_memmove_copyable_v = std::is_pointer_v<InputIterator>
+		&& std::is_pointer_v<OutputIterator>
+		&& std::is_same_v<std::remove_const_t<std::remove_pointer_t<InputIterator>>,
+			std::remove_pointer_t<OutputIterator>>
+		&& std::is_trivially_copyable_v<std::remove_pointer_t<OutputIterator>>
+		&& std::is_trivially_copy_assignable_v<std::remove_pointer_t<OutputIterator>>;
+
+	/**
+	 * Indica si @a Compare es std::less o std::greater, de manera que comparar no tiene
+	 * efectos y cuesta lo mismo que una instruccin.
+	 */
+	template <typename Compare, typename ValueType>
+	constexpr bool is_default_compare_v = std::is_same_v<Compare, std::less<ValueType>>
+		|| std::is_same_v<Compare, std::greater<ValueType>>
+		|| std::is_same_v<Compare, std::less<>>
+		|| std::is_same_v<Compare, std::greater<>>;
+
 	/**
 	 * Copia los elementos en el rango [@a first, @a last) al rango que empieza en @a result.
 	 * 
@@ -42,6 +73,15 @@ namespace mySTL
 	template <typename InputIterator, typename OutputIterator>
 	OutputIterator copy(InputIterator first, InputIterator last, OutputIterator result)
 	{
+		if constexpr (is_memmove_copyable_v<InputIterator, OutputIterator>)
+		{
+			// Copiar todos los bytes de una vez. memmove admite que los rangos se traslapen.
+			const std::size_t count = std::size_t(last - first);
+			if (count > 0)
+				std::memmove(result, first, count * sizeof(*first));
+			return result + count;
+		}
+
 		// Mientras no se haya alcanzado el final del rango
 		while (first != last)
 		{
@@ -64,6 +104,13 @@ namespace mySTL
 	template <typename InputIterator, typename Size, typename OutputIterator>
 	void copy_n(InputIterator first, Size count, OutputIterator result)
 	{
+		if constexpr (is_memmove_copyable_v<InputIterator, OutputIterator>)
+		{
+			if (count > 0)
+				std::memmove(result, first, std::size_t(count) * sizeof(*first));
+			return;
+		}
+
 		// Desde index = 0 hasta index = (count - 1)
 		for (Size index = 0; index < count; ++index)
 		{
@@ -85,6 +132,15 @@ namespace mySTL
 	template <typename BidirectionalIterator1, typename BidirectionalIterator2>
 	void copy_backward(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 result)
 	{
+		if constexpr (is_memmove_copyable_v<BidirectionalIterator1, BidirectionalIterator2>)
+		{
+			// memmove copia correctamente aunque el destino se traslape con el final del origen.
+			const std::size_t count = std::size_t(last - first);
+			if (count > 0)
+				std::memmove(result - count, first, count * sizeof(*first));
+			return;
+		}
+
 		// Mientras no se haya alcanzado el inicio del rango
 		while (last != first)
 		{
@@ -96,6 +152,20 @@ namespace mySTL
 		}
 	}
 
+	/**
+	 * Indica si fill puede rellenar un rango de @a ForwardIterator con simd_fill: es un
+	 * puntero a un tipo escalar modificable de 1, 2, 4 u 8 bytes, alineado a su tamao.
+	 */
+	template <typename ForwardIterator>
+	constexpr bool is_simd_fillable_v = std::is_pointer_v<ForwardIterator>
+		&& std::is_scalar_v<std::remove_pointer_t<ForwardIterator>>
+		&& !std::is_const_v<std::remove_pointer_t<ForwardIterator>>
+		&& ( sizeof(std::remove_pointer_t<ForwardIterator>) == 1
+			|| sizeof(std::remove_pointer_t<ForwardIterator>) == 2
+			|| sizeof(std::remove_pointer_t<ForwardIterator>) == 4
+			|| sizeof(std::remove_pointer_t<ForwardIterator>) == 8 )
+		&& ( alignof(std::remove_pointer_t<ForwardIterator>) == sizeof(std::remove_pointer_t<ForwardIterator>) );
+
 	/**
 	 * Asigna el valor @a value a los elementos en el rango [@a first, @a last).
 	 * 
@@ -106,6 +176,14 @@ namespace mySTL
 	template <typename ForwardIterator, typename ValueType>
 	void fill(ForwardIterator first, ForwardIterator last, const ValueType& value)
 	{
+		if constexpr (is_simd_fillable_v<ForwardIterator>)
+		{
+			// Convertir el valor una sola vez y rellenar con memset o registros vectoriales.
+			const std::remove_pointer_t<ForwardIterator> element = value;
+			mySTL::simd_fill(first, last, element);
+			return;
+		}
+
 		// Mientras no se haya alcanzado el final del rango
 		while (first != last)
 		{
@@ -116,6 +194,30 @@ namespace mySTL
 		}
 	}
 
+	/**
+	 * Indica si dos rangos de @a InputIterator1 e @a InputIterator2 se pueden comparar byte
+	 * por byte: ambos son punteros al mismo tipo entero, enumeracin o puntero, cuyos
+	 * valores son iguales si y solo si sus bytes lo son. Los nmeros de punto flotante no
+	 * cumplen esto (0.0 == -0.0 y NaN != NaN).
+	 */
+	template <typename InputIterator1, typename InputIterator2>
+	constexpr bool is_bytewise_comparable_v = std::is_pointer_v<InputIterator1>
+		&& std::is_pointer_v<InputIterator2>
+		&& std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InputIterator1>>,
+			std::remove_cv_t<std::remove_pointer_t<InputIterator2>>>
+		&& ( std::is_integral_v<std::remove_pointer_t<InputIterator1>>
+			|| std::is_enum_v<std::remove_pointer_t<InputIterator1>>
+			|| std::is_pointer_v<std::remove_pointer_t<InputIterator1>> );
+
+	/**
+	 * Indica si el orden de dos rangos de @a InputIterator1 e @a InputIterator2 es el
+	 * orden de memcmp: son rangos comparables byte por byte de un tipo sin signo de un byte.
+	 */
+	template <typename InputIterator1, typename InputIterator2>
+	constexpr bool is_memcmp_ordered_v = is_bytewise_comparable_v<InputIterator1, InputIterator2>
+		&& ( sizeof(std::remove_pointer_t<InputIterator1>) == 1 )
+		&& std::is_unsigned_v<std::remove_pointer_t<InputIterator1>>;
+
 	/**
 	 * Compara los elementos en el rango [@a first1, @a last1) con los del rango que empieza en @a first2
 	 * y retorna TRUE si todos los elementos en ambos rangos coinciden.
@@ -128,6 +230,13 @@ namespace mySTL
 	template <typename InputIterator1, typename InputIterator2>
 	bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
 	{
+		if constexpr (is_bytewise_comparable_v<InputIterator1, InputIterator2>)
+		{
+			// Comparar todos los bytes con memcmp, sin una rama por elemento.
+			const std::size_t count = std::size_t(last1 - first1);
+			return ( count == 0 ) || ( std::memcmp(first1, first2, count * sizeof(*first1)) == 0 );
+		}
+
 		// Mientras no se haya alcanzado el final del rango
 		while (first1 != last1)
 		{
@@ -155,6 +264,31 @@ namespace mySTL
 	bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
 		InputIterator2 first2, InputIterator2 last2)
 	{
+		if constexpr (is_bytewise_comparable_v<InputIterator1, InputIterator2>)
+		{
+			const std::size_t count1 = std::size_t(last1 - first1);
+			const std::size_t count2 = std::size_t(last2 - first2);
+			const std::size_t common = ( (count2 < count1) ? count2 : count1 );
+
+			if constexpr (is_memcmp_ordered_v<InputIterator1, InputIterator2>)
+			{
+				// Para bytes sin signo, el orden de memcmp es el orden lexicogrfico.
+				const int result = ( (common == 0) ? 0 : std::memcmp(first1, first2, common) );
+				if (result != 0)
+					return ( result < 0 );
+			}
+			else
+			{
+				// Buscar el primer elemento distinto con registros vectoriales y compararlo.
+				const std::size_t index = mySTL::simd_mismatch(first1, first2, common);
+				if (index < common)
+					return ( first1[index] < first2[index] );
+			}
+
+			// Si el prefijo comn es igual, la secuencia ms corta es la menor.
+			return ( count1 < count2 );
+		}
+
 		// Mientras no se haya alcanzado el final del rango de la primera secuencia
 		while (first1 != last1)
 		{
@@ -181,6 +315,509 @@ namespace mySTL
 		return false; // No es menor.
 	}
 
+	/**
+	 * Aplica @a function a cada elemento en el rango [@a first, @a last).
+	 * 
+	 * @param first		Iterador a la posicin inicial de la secuencia.
+	 * @param last		Iterador a la posicin final de la secuencia.
+	 * @param function	Funcin que recibe cada elemento.
+	 * @return @a function, despus de aplicarla a todos los elementos.
+	 */
+	template <typename InputIterator, typename Function>
+	Function for_each(InputIterator first, InputIterator last, Function function)
+	{
+		for (; first != last; ++first)
+			function(*first);
+		return function;
+	}
+
+	/**
+	 * Aplica @a operation a cada elemento en el rango [@a first, @a last) y guarda los
+	 * resultados en el rango que empieza en @a result.
+	 * 
+	 * @param first		Iterador a la posicin inicial de la secuencia de entrada.
+	 * @param last		Iterador a la posicin final de la secuencia de entrada.
+	 * @param result	Iterador a la posicin inicial de la secuencia destino.
+	 * @param operation	Funcin que recibe un elemento y retorna el valor por guardar.
+	 * @return Iterador al final del rango destino.
+	 */
+	template <typename InputIterator, typename OutputIterator, typename UnaryOperation>
+	OutputIterator transform(InputIterator first, InputIterator last, OutputIterator result,
+		UnaryOperation operation)
+	{
+		for (; first != last; ++first, ++result)
+			*result = operation(*first);
+		return result;
+	}
+
+	/**
+	 * Combina @a init y los elementos en el rango [@a first, @a last) con @a operation.
+	 * La operacin debe ser asociativa y conmutativa, porque las versiones paralelas
+	 * combinan los elementos en otro orden.
+	 * 
+	 * @param first		Iterador a la posicin inicial de la secuencia.
+	 * @param last		Iterador a la posicin final de la secuencia.
+	 * @param init		El valor inicial.
+	 * @param operation	Funcin que combina dos valores.
+	 * @return El resultado de combinar todos los valores.
+	 */
+	template <typename InputIterator, typename ValueType, typename BinaryOperation>
+	ValueType reduce(InputIterator first, InputIterator last, ValueType init, BinaryOperation operation)
+	{
+		for (; first != last; ++first)
+			init = operation(init, *first);
+		return init;
+	}
+
+	/**
+	 * Suma @a init y los elementos en el rango [@a first, @a last).
+	 * 
+	 * @param first		Iterador a la posicin inicial de la secuencia.
+	 * @param last		Iterador a la posicin final de la secuencia.
+	 * @param init		El valor inicial.
+	 * @return La suma de todos los valores.
+	 */
+	template <typename InputIterator, typename ValueType>
+	ValueType reduce(InputIterator first, InputIterator last, ValueType init)
+	{
+		for (; first != last; ++first)
+			init = init + *first;
+		return init;
+	}
+
+	/**
+	 * Cuenta los elementos en el rango [@a first, @a last) para los que @a predicate
+	 * retorna TRUE.
+	 * 
+	 * @param first		Iterador a la posicin inicial de la secuencia.
+	 * @param last		Iterador a la posicin final de la secuencia.
+	 * @param predicate	Funcin que recibe un elemento y retorna un bool.
+	 * @return La cantidad de elementos que cumplen el predicado.
+	 */
+	template <typename InputIterator, typename Predicate>
+	typename std::iterator_traits<InputIterator>::difference_type
+		count_if(InputIterator first, InputIterator last, Predicate predicate)
+	{
+		typename std::iterator_traits<InputIterator>::difference_type count = 0;
+		for (; first != last; ++first)
+			if (predicate(*first))
+				++count;
+		return count;
+	}
+
+	/**
+	 * Indica si buscar @a ValueType en un rango de @a InputIterator puede hacerse con
+	 * registros vectoriales: el rango es un arreglo contiguo de enteros de 1, 2, 4 u 8
+	 * bytes y el valor buscado tambin es un entero.
+	 */
+	template <typename InputIterator, typename ValueType>
+	constexpr bool is_simd_searchable_v = std::is_pointer_v<InputIterator>
+		&& std::is_integral_v<std::remove_cv_t<std::remove_pointer_t<InputIterator>>>
+		&& !std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InputIterator>>, bool>
+		&& std::is_integral_v<ValueType> && !std::is_same_v<ValueType, bool>
+		&& ( sizeof(std::remove_pointer_t<InputIterator>) == 1 || sizeof(std::remove_pointer_t<InputIterator>) == 2
+			|| sizeof(std::remove_pointer_t<InputIterator>) == 4 || sizeof(std::remove_pointer_t<InputIterator>) == 8 );
+
+	/**
+	 * Convierte @a value al tipo de los elementos de un arreglo de enteros, si algn
+	 * elemento puede ser igual a l. Se compara como lo hara *first == value, con las
+	 * promociones y conversiones de siempre: si el valor convertido no es igual a
+	 * @a value (por ejemplo, 300 o -1 en un arreglo de uint8_t, o '\xff' con char con
+	 * signo, que se promueve a -1), ningn elemento es igual.
+	 *
+	 * @param value		El valor por buscar.
+	 * @param element	Donde se guarda el valor convertido.
+	 * @return TRUE si algn elemento del arreglo puede ser igual a @a value; de lo contrario FALSE.
+	 */
+	template <typename ElementType, typename ValueType>
+	inline bool to_element_value(const ValueType& value, ElementType& element) noexcept
+	{
+		// El tipo comn es el de las conversiones aritmticas de ==; compararlo de forma
+		// explcita evita la advertencia de comparar enteros con y sin signo.
+		typedef std::common_type_t<ElementType, ValueType> common_type;
+		element = static_cast<ElementType>(value);
+		return static_cast<common_type>(element) == static_cast<common_type>(value);
+	}
+
+	/**
+	 * Busca el primer elemento igual a @a value en el rango [@a first, @a last). En
+	 * arreglos contiguos de enteros compara varios elementos a la vez con simd_find.
+	 *
+	 * @param first		Iterador a la posicin inicial de la secuencia.
+	 * @param last		Iterador a la posicin final de la secuencia.
+	 * @param value		El valor por buscar.
+	 * @return Iterador al primer elemento igual a @a value, o @a last si no hay.
+	 */
+	template <typename InputIterator, typename ValueType>
+	InputIterator find(InputIterator first, InputIterator last, const ValueType& value)
+	{
+		if constexpr (is_simd_searchable_v<InputIterator, ValueType>)
+		{
+			std::remove_cv_t<std::remove_pointer_t<InputIterator>> element;
+			if (!mySTL::to_element_value(value, element))
+				return last;
+			return first + mySTL::simd_find(first, std::size_t(last - first), element);
+		}
+		else
+		{
+			for (; first != last; ++first)
+				if (*first == value)
+					return first;
+			return last;
+		}
+	}
+
+	/**
+	 * Cuenta los elementos iguales a @a value en el rango [@a first, @a last). En
+	 * arreglos contiguos de enteros compara varios elementos a la vez con simd_count.
+	 *
+	 * @param first		Iterador a la posicin inicial de la secuencia.
+	 * @param last		Iterador a la posicin final de la secuencia.
+	 * @param value		El valor por contar.
+	 * @return La cantidad de elementos iguales a @a value.
+	 */
+	template <typename InputIterator, typename ValueType>
+	typename std::iterator_traits<InputIterator>::difference_type
+		count(InputIterator first, InputIterator last, const ValueType& value)
+	{
+		typedef typename std::iterator_traits<InputIterator>::difference_type difference_type;
+		if constexpr (is_simd_searchable_v<InputIterator, ValueType>)
+		{
+			std::remove_cv_t<std::remove_pointer_t<InputIterator>> element;
+			if (!mySTL::to_element_value(value, element))
+				return 0;
+			return difference_type(mySTL::simd_count(first, std::size_t(last - first), element));
+		}
+		else
+		{
+			difference_type count = 0;
+			for (; first != last; ++first)
+				if (*first == value)
+					++count;
+			return count;
+		}
+	}
+
+	/**
+	 * Busca la primera posicin en la que el rango [@a first1, @a last1) y el rango que
+	 * empieza en @a first2 tienen elementos distintos. En arreglos contiguos de enteros,
+	 * punteros o enumeraciones compara bloques de bytes con simd_mismatch.
+	 *
+	 * @param first1	Iterador a la posicin inicial de la primera secuencia.
+	 * @param last1		Iterador a la posicin final de la primera secuencia.
+	 * @param first2	Iterador a la posicin inicial de la segunda secuencia.
+	 * @return Par de iteradores a los primeros elementos distintos, o @a last1 y su
+	 * correspondiente en la segunda secuencia si no hay.
+	 */
+	template <typename InputIterator1, typename InputIterator2>
+	std::pair<InputIterator1, InputIterator2> mismatch(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2)
+	{
+		if constexpr (is_bytewise_comparable_v<InputIterator1, InputIterator2>)
+		{
+			const std::size_t index = mySTL::simd_mismatch(first1, first2, std::size_t(last1 - first1));
+			return std::pair<InputIterator1, InputIterator2>(first1 + index, first2 + index);
+		}
+		else
+		{
+			while (first1 != last1 && *first1 == *first2)
+			{
+				++first1;
+				++first2;
+			}
+			return std::pair<InputIterator1, InputIterator2>(first1, first2);
+		}
+	}
+
+	/**
+	 * Busca la primera posicin en la que los rangos [@a first1, @a last1) y
+	 * [@a first2, @a last2) tienen elementos distintos, o en la que termina el ms corto.
+	 *
+	 * @param first1	Iterador a la posicin inicial de la primera secuencia.
+	 * @param last1		Iterador a la posicin final de la primera secuencia.
+	 * @param first2	Iterador a la posicin inicial de la segunda secuencia.
+	 * @param last2		Iterador a la posicin final de la segunda secuencia.
+	 * @return Par de iteradores a los primeros elementos distintos o al final del rango
+	 * ms corto y su correspondiente en el otro.
+	 */
+	template <typename InputIterator1, typename InputIterator2>
+	std::pair<InputIterator1, InputIterator2> mismatch(InputIterator1 first1, InputIterator1 last1,
+		InputIterator2 first2, InputIterator2 last2)
+	{
+		if constexpr (is_bytewise_comparable_v<InputIterator1, InputIterator2>)
+		{
+			const std::size_t count1 = std::size_t(last1 - first1);
+			const std::size_t count2 = std::size_t(last2 - first2);
+			return mySTL::mismatch(first1, first1 + ( (count2 < count1) ? count2 : count1 ), first2);
+		}
+		else
+		{
+			while (first1 != last1 && first2 != last2 && *first1 == *first2)
+			{
+				++first1;
+				++first2;
+			}
+			return std::pair<InputIterator1, InputIterator2>(first1, first2);
+		}
+	}
+
+	/**
+	 * Invierte el orden de los elementos en el rango [@a first, @a last).
+	 *
+	 * @param first		Iterador bidireccional a la posicin inicial de la secuencia.
+	 * @param last		Iterador bidireccional a la posicin final de la secuencia.
+	 */
+	template <typename BidirectionalIterator>
+	void reverse(BidirectionalIterator first, BidirectionalIterator last)
+	{
+		while (first != last && first != --last)
+		{
+			std::iter_swap(first, last);
+			++first;
+		}
+	}
+
+	/**
+	 * Rota los elementos en el rango [@a first, @a last) de manera que @a middle quede
+	 * como el primer elemento. Invierte cada mitad y despus el rango completo.
+	 *
+	 * @param first		Iterador a la posicin inicial de la secuencia.
+	 * @param middle	Iterador al elemento que debe quedar al inicio.
+	 * @param last		Iterador a la posicin final de la secuencia.
+	 * @return Iterador a la nueva posicin del elemento que estaba en @a first.
+	 */
+	template <typename BidirectionalIterator>
+	BidirectionalIterator rotate(BidirectionalIterator first, BidirectionalIterator middle,
+		BidirectionalIterator last)
+	{
+		if (first == middle)
+			return last;
+		if (middle == last)
+			return first;
+
+		mySTL::reverse(first, middle);
+		mySTL::reverse(middle, last);
+		mySTL::reverse(first, last);
+		return std::next(first, std::distance(middle, last));
+	}
+
+	/**
+	 * Pide al procesador que traiga a la cach la lnea que contiene @a address, sin
+	 * esperar el resultado. No tiene efecto si el compilador no lo permite.
+	 *
+	 * @param address	Cualquier direccin; no hace falta que sea vlida.
+	 */
+	inline void prefetch_read(const void* address) noexcept
+	{
+#if defined(__GNUC__)
+		__builtin_prefetch(address, 0, 3);
+#else
+		(void) address;
+#endif
+	}
+
+	/**
+	 * Indica si una bsqueda binaria sobre [first, last) puede hacerse sin saltos
+	 * condicionales: el rango es contiguo, de nmeros, y la comparacin es la de los
+	 * operadores < o >.
+	 */
+	template <typename Iterator, typename Compare>
+	constexpr bool is_branchless_search_v = std::is_pointer_v<Iterator>
+		&& std::is_arithmetic_v<typename std::iterator_traits<Iterator>::value_type>
+		&& is_default_compare_v<Compare, typename std::iterator_traits<Iterator>::value_type>;
+
+	/**
+	 * Bsqueda binaria sin saltos condicionales de lower_bound. En cada paso se descarta la
+	 * mitad del rango con una seleccin (cmov) en lugar de un salto que el procesador no
+	 * puede predecir, y se piden a la cach los dos posibles elementos del paso siguiente.
+	 *
+	 * @param first, last	Punteros a los lmites de la secuencia ordenada.
+	 * @param value			El valor por buscar.
+	 * @param compare		Criterio de comparacin con el que se orden la secuencia.
+	 * @return Puntero al primer elemento no menor que @a value, o @a last si no hay.
+	 */
+	template <typename ElementType, typename ValueType, typename Compare>
+	ElementType* branchless_lower_bound(ElementType* first, ElementType* last, const ValueType& value,
+		Compare& compare)
+	{
+		std::size_t count = std::size_t(last - first);
+		if (count == 0)
+			return first;
+
+		// La respuesta est siempre en [first, first + count].
+		while (count > 1)
+		{
+			const std::size_t half = count / 2;
+			prefetch_read(first + half / 2);
+			prefetch_read(first + half + half / 2);
+			first = compare(first[half], value) ? first + half : first;
+			count -= half;
+		}
+		return first + compare(*first, value);
+	}
+
+	/**
+	 * Bsqueda binaria sin saltos condicionales de upper_bound.
+	 *
+	 * @param first, last	Punteros a los lmites de la secuencia ordenada.
+	 * @param value			El valor por buscar.
+	 * @param compare		Criterio de comparacin con el que se orden la secuencia.
+	 * @return Puntero al primer elemento mayor que @a value, o @a last si no hay.
+	 */
+	template <typename ElementType, typename ValueType, typename Compare>
+	ElementType* branchless_upper_bound(ElementType* first, ElementType* last, const ValueType& value,
+		Compare& compare)
+	{
+		std::size_t count = std::size_t(last - first);
+		if (count == 0)
+			return first;
+
+		while (count > 1)
+		{
+			const std::size_t half = count / 2;
+			prefetch_read(first + half / 2);
+			prefetch_read(first + half + half / 2);
+			first = !compare(value, first[half]) ? first + half : first;
+			count -= half;
+		}
+		return first + !compare(value, *first);
+	}
+
+	/**
+	 * Busca en el rango ordenado [@a first, @a last) el primer elemento que no es menor
+	 * que @a value segn @a compare. Para arreglos de nmeros comparados con < o >, usa
+	 * branchless_lower_bound.
+	 *
+	 * @param first		Iterador a la posicin inicial de la secuencia ordenada.
+	 * @param last		Iterador a la posicin final de la secuencia ordenada.
+	 * @param value		El valor por buscar.
+	 * @param compare	Criterio de comparacin con el que se orden la secuencia.
+	 * @return Iterador al primer elemento no menor que @a value, o @a last si no hay.
+	 */
+	template <typename ForwardIterator, typename ValueType, typename Compare>
+	ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const ValueType& value,
+		Compare compare)
+	{
+		if constexpr (is_branchless_search_v<ForwardIterator, Compare>)
+			return mySTL::branchless_lower_bound(first, last, value, compare);
+		else
+		{
+			typename std::iterator_traits<ForwardIterator>::difference_type count = std::distance(first, last);
+			while (count > 0)
+			{
+				const auto half = count / 2;
+				ForwardIterator middle = std::next(first, half);
+				if (compare(*middle, value))
+				{
+					first = ++middle;
+					count -= half + 1;
+				}
+				else
+					count = half;
+			}
+			return first;
+		}
+	}
+
+	/**
+	 * Busca en el rango ordenado [@a first, @a last) el primer elemento que no es menor
+	 * que @a value.
+	 *
+	 * @param first		Iterador a la posicin inicial de la secuencia ordenada.
+	 * @param last		Iterador a la posicin final de la secuencia ordenada.
+	 * @param value		El valor por buscar.
+	 * @return Iterador al primer elemento no menor que @a value, o @a last si no hay.
+	 */
+	template <typename ForwardIterator, typename ValueType>
+	ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const ValueType& value)
+	{
+		return mySTL::lower_bound(first, last, value, std::less<>());
+	}
+
+	/**
+	 * Busca en el rango ordenado [@a first, @a last) el primer elemento que es mayor
+	 * que @a value segn @a compare. Para arreglos de nmeros comparados con < o >, usa
+	 * branchless_upper_bound.
+	 *
+	 * @param first		Iterador a la posicin inicial de la secuencia ordenada.
+	 * @param last		Iterador a la posicin final de la secuencia ordenada.
+	 * @param value		El valor por buscar.
+	 * @param compare	Criterio de comparacin con el que se orden la secuencia.
+	 * @return Iterador al primer elemento mayor que @a value, o @a last si no hay.
+	 */
+	template <typename ForwardIterator, typename ValueType, typename Compare>
+	ForwardIterator upper_bound(ForwardIterator first, ForwardIterator last, const ValueType& value,
+		Compare compare)
+	{
+		if constexpr (is_branchless_search_v<ForwardIterator, Compare>)
+			return mySTL::branchless_upper_bound(first, last, value, compare);
+		else
+		{
+			typename std::iterator_traits<ForwardIterator>::difference_type count = std::distance(first, last);
+			while (count > 0)
+			{
+				const auto half = count / 2;
+				ForwardIterator middle = std::next(first, half);
+				if (!compare(value, *middle))
+				{
+					first = ++middle;
+					count -= half + 1;
+				}
+				else
+					count = half;
+			}
+			return first;
+		}
+	}
+
+	/**
+	 * Busca en el rango ordenado [@a first, @a last) el primer elemento que es mayor
+	 * que @a value.
+	 *
+	 * @param first		Iterador a la posicin inicial de la secuencia ordenada.
+	 * @param last		Iterador a la posicin final de la secuencia ordenada.
+	 * @param value		El valor por buscar.
+	 * @return Iterador al primer elemento mayor que @a value, o @a last si no hay.
+	 */
+	template <typename ForwardIterator, typename ValueType>
+	ForwardIterator upper_bound(ForwardIterator first, ForwardIterator last, const ValueType& value)
+	{
+		return mySTL::upper_bound(first, last, value, std::less<>());
+	}
+
+	/**
+	 * Verifica si el rango ordenado [@a first, @a last) contiene un elemento equivalente
+	 * a @a value segn @a compare.
+	 *
+	 * @param first		Iterador a la posicin inicial de la secuencia ordenada.
+	 * @param last		Iterador a la posicin final de la secuencia ordenada.
+	 * @param value		El valor por buscar.
+	 * @param compare	Criterio de comparacin con el que se orden la secuencia.
+	 * @return TRUE si el valor est en la secuencia, FALSE si no.
+	 */
+	template <typename ForwardIterator, typename ValueType, typename Compare>
+	bool binary_search(ForwardIterator first, ForwardIterator last, const ValueType& value,
+		Compare compare)
+	{
+		first = mySTL::lower_bound(first, last, value, compare);
+		return first != last && !compare(value, *first);
+	}
+
+	/**
+	 * Verifica si el rango ordenado [@a first, @a last) contiene un elemento igual a
+	 * @a value.
+	 *
+	 * @param first		Iterador a la posicin inicial de la secuencia ordenada.
+	 * @param last		Iterador a la posicin final de la secuencia ordenada.
+	 * @param value		El valor por buscar.
+	 * @return TRUE si el valor est en la secuencia, FALSE si no.
+	 */
+	template <typename ForwardIterator, typename ValueType>
+	bool binary_search(ForwardIterator first, ForwardIterator last, const ValueType& value)
+	{
+		return mySTL::binary_search(first, last, value, std::less<>());
+	}
+
 	/**
 	 * Retorna el mayor entre @a value1 y @a value2. Si ambos son iguales, 
 	 * retorna @a value1.
@@ -195,6 +832,21 @@ namespace mySTL
 		// De lo contrario, retornar el primer valor.
 		return ( (value1 < value2) ? value2 : value1 );
 	}
+
+	/**
+	 * Retorna el menor entre @a value1 y @a value2. Si ambos son iguales, 
+	 * retorna @a value1.
+	 * 
+	 * @param value1, value2	Valores por comparar.
+	 * @return El menor de los valores recibidos.
+	 */
+	template <typename ValueType>
+	inline const ValueType& min(const ValueType& value1, const ValueType& value2)
+	{
+		// Si el segundo valor es menor que el primero, retornar el segundo valor.
+		// De lo contrario, retornar el primer valor.
+		return ( (value2 < value1) ? value2 : value1 );
+	}
 }
 
 #endif /* MY_ALGORITHM_H */
@@ -0,0 +1,412 @@
+#ifndef MY_EXECUTION_H
+#define MY_EXECUTION_H
+
+#include "my_algorithm.h"
+#include "../work_stealing/my_parallel.h"
+#include "../work_stealing/my_thread_pool.h"
+#include "../vector/my_vector.h"
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+
+// Cantidad mnima de bytes por tarea en los algoritmos que solo mueven memoria (copy,
+// fill, equal, swap_ranges). Con menos, crear la tarea cuesta ms que lo que se gana.
+#ifndef MY_PARALLEL_MIN_BYTES
+#define MY_PARALLEL_MIN_BYTES (std::size_t(64) << 10)
+#endif
+
+// Cantidad mnima de elementos por tarea en los algoritmos que llaman a una funcin por
+// elemento (for_each, transform, reduce, count_if).
+#ifndef MY_PARALLEL_MIN_GRAIN
+#define MY_PARALLEL_MIN_GRAIN std::size_t(4096)
+#endif
+
+namespace mySTL
+{
+	// Este encabezado contiene versiones de los algoritmos de my_algorithm.h que reciben
+	// una poltica de ejecucin como primer parmetro, igual que en C++17. Las versiones
+	// paralelas dividen el rango con split_range y ejecutan las partes en un thread_pool.
+	// Como en la biblioteca estndar, las funciones que se pasan a un algoritmo paralelo
+	// no deben lanzar excepciones.
+
+	namespace execution
+	{
+		/// Ejecuta el algoritmo en el hilo que lo llama.
+		struct sequenced_policy
+		{
+		};
+
+		/// Ejecuta el algoritmo en varios hilos.
+		struct parallel_policy
+		{
+			thread_pool* pool = nullptr; // El pool por usar, o nullptr para el pool por defecto.
+
+			/// Retorna una poltica igual que usa los hilos de @a other_pool.
+			parallel_policy on(thread_pool& other_pool) const { return parallel_policy{ &other_pool }; }
+		};
+
+		/**
+		 * Ejecuta el algoritmo en varios hilos, permitiendo adems vectorizar. Cada parte
+		 * ya usa las rutinas vectoriales de my_simd.h cuando el tipo lo permite, as que se
+		 * ejecuta igual que parallel_policy.
+		 */
+		struct parallel_unsequenced_policy
+		{
+			thread_pool* pool = nullptr; // El pool por usar, o nullptr para el pool por defecto.
+
+			/// Retorna una poltica igual que usa los hilos de @a other_pool.
+			parallel_unsequenced_policy on(thread_pool& other_pool) const
+			{
+				return parallel_unsequenced_policy{ &other_pool };
+			}
+		};
+
+		inline constexpr sequenced_policy seq{};
+		inline constexpr parallel_policy par{};
+		inline constexpr parallel_unsequenced_policy par_unseq{};
+	}
+
+	/// Indica si @a PolicyType es una poltica de ejecucin.
+	template <typename PolicyType>
+	struct is_execution_policy : std::false_type
+	{
+	};
+
+	template <>
+	struct is_execution_policy<execution::sequenced_policy> : std::true_type
+	{
+	};
+
+	template <>
+	struct is_execution_policy<execution::parallel_policy> : std::true_type
+	{
+	};
+
+	template <>
+	struct is_execution_policy<execution::parallel_unsequenced_policy> : std::true_type
+	{
+	};
+
+	template <typename PolicyType>
+	constexpr bool is_execution_policy_v = is_execution_policy<std::decay_t<PolicyType>>::value;
+
+	/**
+	 * Retorna el pool que usan las polticas paralelas sin un pool propio. Se crea la
+	 * primera vez que se usa, con un hilo menos que la cantidad de ncleos, porque el
+	 * hilo que llama al algoritmo tambin ejecuta partes.
+	 */
+	inline thread_pool& default_thread_pool()
+	{
+		static thread_pool pool(std::thread::hardware_concurrency() > 1
+			? std::thread::hardware_concurrency() - 1 : 1);
+		return pool;
+	}
+
+	/**
+	 * Divide [@a first, @a last) segn la poltica: en una sola parte si es secuencial o
+	 * si el rango es pequeo; de lo contrario, en hasta cuatro partes por hilo, cada una
+	 * de al menos @a min_grain elementos.
+	 *
+	 * @param policy		La poltica de ejecucin.
+	 * @param first, last	Iteradores a las posiciones inicial y final en un rango.
+	 * @param min_grain		La cantidad mnima de elementos por parte.
+	 * @return los lmites de las partes, como los de split_range.
+	 */
+	template <typename ExecutionPolicy, typename Iterator>
+	mySTL::vector<Iterator> execution_bounds(const ExecutionPolicy& policy, Iterator first, Iterator last,
+		std::size_t min_grain)
+	{
+		std::size_t parts = 1;
+		if constexpr (!std::is_same_v<ExecutionPolicy, execution::sequenced_policy>)
+		{
+			const std::size_t workers = ( policy.pool ? policy.pool->size() : default_thread_pool().size() ) + 1;
+			const std::size_t count = std::size_t(last - first);
+			parts = count / ( (min_grain > 0) ? min_grain : 1 );
+			if (parts > 4 * workers)
+				parts = 4 * workers;
+		}
+
+		if (parts <= 1)
+		{
+			mySTL::vector<Iterator> bounds;
+			bounds.reserve(2);
+			bounds.push_back(first);
+			bounds.push_back(last);
+			return bounds;
+		}
+		return split_range(first, last, parts);
+	}
+
+	/**
+	 * Llama a @a function con el nmero de cada parte, 0 hasta @a parts - 1. La parte 0
+	 * se ejecuta en el hilo que llama y las dems en el pool de la poltica.
+	 *
+	 * @param policy	La poltica de ejecucin.
+	 * @param parts		La cantidad de partes.
+	 * @param function	Funcin que recibe el nmero de una parte.
+	 */
+	template <typename ExecutionPolicy, typename Function>
+	void execute_parts(const ExecutionPolicy& policy, std::size_t parts, const Function& function)
+	{
+		if (parts <= 1)
+		{
+			function(std::size_t(0));
+			return;
+		}
+
+		if constexpr (!std::is_same_v<ExecutionPolicy, execution::sequenced_policy>)
+		{
+			task_group group( policy.pool ? *policy.pool : default_thread_pool() );
+			for (std::size_t part = 1; part < parts; ++part)
+				group.run([&function, part]() { function(part); });
+			function(std::size_t(0));
+			group.wait();
+		}
+	}
+
+	/**
+	 * Retorna la cantidad mnima de elementos de tipo @a ValueType por tarea en los
+	 * algoritmos que solo mueven memoria.
+	 */
+	template <typename ValueType>
+	constexpr std::size_t memory_grain() noexcept
+	{
+		return ( (MY_PARALLEL_MIN_BYTES / sizeof(ValueType)) > 0 ) ? MY_PARALLEL_MIN_BYTES / sizeof(ValueType) : 1;
+	}
+
+	/**
+	 * Copia los elementos en el rango [@a first, @a last) al rango que empieza en @a result,
+	 * segn @a policy. Los rangos no deben traslaparse.
+	 *
+	 * @param policy	La poltica de ejecucin.
+	 * @param first		Iterador a la posicin inicial de la secuencia por copiar.
+	 * @param last		Iterador a la posicin final de la secuencia por copiar.
+	 * @param result	Iterador a la posicin inicial de la secuencia destino.
+	 * @return Iterador al final del rango destino donde se copiaron los elementos.
+	 */
+	template <typename ExecutionPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2,
+		typename = std::enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+	RandomAccessIterator2 copy(ExecutionPolicy&& policy, RandomAccessIterator1 first, RandomAccessIterator1 last,
+		RandomAccessIterator2 result)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator1>::value_type value_type;
+		const auto bounds = execution_bounds(policy, first, last, memory_grain<value_type>());
+
+		execute_parts(policy, bounds.size() - 1, [&](std::size_t part)
+		{
+			mySTL::copy(bounds[part], bounds[part + 1], result + (bounds[part] - first));
+		});
+		return result + (last - first);
+	}
+
+	/**
+	 * Asigna el valor @a value a los elementos en el rango [@a first, @a last), segn @a policy.
+	 *
+	 * @param policy	La poltica de ejecucin.
+	 * @param first		Iterador a la posicin inicial de una secuencia de elementos.
+	 * @param last		Iterador a la posicin final de una secuencia de elementos.
+	 * @param value		El valor por asignar a los elementos en el rango de relleno.
+	 */
+	template <typename ExecutionPolicy, typename RandomAccessIterator, typename ValueType,
+		typename = std::enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+	void fill(ExecutionPolicy&& policy, RandomAccessIterator first, RandomAccessIterator last,
+		const ValueType& value)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+		const auto bounds = execution_bounds(policy, first, last, memory_grain<value_type>());
+
+		execute_parts(policy, bounds.size() - 1, [&](std::size_t part)
+		{
+			mySTL::fill(bounds[part], bounds[part + 1], value);
+		});
+	}
+
+	/**
+	 * Compara los elementos en el rango [@a first1, @a last1) con los del rango que empieza
+	 * en @a first2, segn @a policy. Cuando una parte encuentra una diferencia, las partes
+	 * que todava no empezaron ya no comparan.
+	 *
+	 * @param policy	La poltica de ejecucin.
+	 * @param first1	Iterador a la posicin inicial de la primera secuencia por comparar.
+	 * @param last1		Iterador a la posicin final de la primera secuencia por comparar.
+	 * @param first2	Iterador a la posicin inicial de la segunda secuencia por comparar.
+	 * @return TRUE si todos los elementos entre ambas secuencias coinciden; de lo contrario FALSE.
+	 */
+	template <typename ExecutionPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2,
+		typename = std::enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+	bool equal(ExecutionPolicy&& policy, RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+		RandomAccessIterator2 first2)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator1>::value_type value_type;
+		const auto bounds = execution_bounds(policy, first1, last1, memory_grain<value_type>());
+		std::atomic<bool> different(false);
+
+		execute_parts(policy, bounds.size() - 1, [&](std::size_t part)
+		{
+			if (!different.load(std::memory_order_relaxed)
+				&& !mySTL::equal(bounds[part], bounds[part + 1], first2 + (bounds[part] - first1)))
+				different.store(true, std::memory_order_relaxed);
+		});
+		return !different.load();
+	}
+
+	/**
+	 * Intercambia los valores de cada uno de los elementos en el rango [@a first1, @a last1)
+	 * con los de sus respectivos elementos en el rango que empieza en @a first2, segn @a policy.
+	 *
+	 * @param policy	La poltica de ejecucin.
+	 * @param first1	Iterador a la posicin inicial de una de las secuencias por intercambiar.
+	 * @param last1		Iterador a la posicin final de una de las secuencias por intercambiar.
+	 * @param first2	Iterador a la posicin inicial de la otra secuencia por intercambiar.
+	 */
+	template <typename ExecutionPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2,
+		typename = std::enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+	void swap_ranges(ExecutionPolicy&& policy, RandomAccessIterator1 first1, RandomAccessIterator1 last1,
+		RandomAccessIterator2 first2)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator1>::value_type value_type;
+		const auto bounds = execution_bounds(policy, first1, last1, memory_grain<value_type>());
+
+		execute_parts(policy, bounds.size() - 1, [&](std::size_t part)
+		{
+			mySTL::swap_ranges(bounds[part], bounds[part + 1], first2 + (bounds[part] - first1));
+		});
+	}
+
+	/**
+	 * Aplica @a function a cada elemento en el rango [@a first, @a last), segn @a policy.
+	 * Con una poltica paralela, @a function se llama desde varios hilos a la vez.
+	 *
+	 * @param policy	La poltica de ejecucin.
+	 * @param first		Iterador a la posicin inicial de la secuencia.
+	 * @param last		Iterador a la posicin final de la secuencia.
+	 * @param function	Funcin que recibe cada elemento.
+	 */
+	template <typename ExecutionPolicy, typename RandomAccessIterator, typename Function,
+		typename = std::enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+	void for_each(ExecutionPolicy&& policy, RandomAccessIterator first, RandomAccessIterator last,
+		Function function)
+	{
+		const auto bounds = execution_bounds(policy, first, last, MY_PARALLEL_MIN_GRAIN);
+
+		execute_parts(policy, bounds.size() - 1, [&](std::size_t part)
+		{
+			mySTL::for_each(bounds[part], bounds[part + 1], function);
+		});
+	}
+
+	/**
+	 * Aplica @a operation a cada elemento en el rango [@a first, @a last) y guarda los
+	 * resultados en el rango que empieza en @a result, segn @a policy.
+	 *
+	 * @param policy	La poltica de ejecucin.
+	 * @param first		Iterador a la posicin inicial de la secuencia de entrada.
+	 * @param last		Iterador a la posicin final de la secuencia de entrada.
+	 * @param result	Iterador a la posicin inicial de la secuencia destino.
+	 * @param operation	Funcin que recibe un elemento y retorna el valor por guardar.
+	 * @return Iterador al final del rango destino.
+	 */
+	template <typename ExecutionPolicy, typename RandomAccessIterator1, typename RandomAccessIterator2,
+		typename UnaryOperation, typename = std::enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+	RandomAccessIterator2 transform(ExecutionPolicy&& policy, RandomAccessIterator1 first,
+		RandomAccessIterator1 last, RandomAccessIterator2 result, UnaryOperation operation)
+	{
+		const auto bounds = execution_bounds(policy, first, last, MY_PARALLEL_MIN_GRAIN);
+
+		execute_parts(policy, bounds.size() - 1, [&](std::size_t part)
+		{
+			mySTL::transform(bounds[part], bounds[part + 1], result + (bounds[part] - first), operation);
+		});
+		return result + (last - first);
+	}
+
+	/**
+	 * Combina @a init y los elementos en el rango [@a first, @a last) con @a operation,
+	 * segn @a policy. Cada parte combina sus elementos y despus se combinan los
+	 * resultados de las partes en orden, as que @a operation debe ser asociativa y
+	 * conmutativa.
+	 *
+	 * @param policy	La poltica de ejecucin.
+	 * @param first		Iterador a la posicin inicial de la secuencia.
+	 * @param last		Iterador a la posicin final de la secuencia.
+	 * @param init		El valor inicial.
+	 * @param operation	Funcin que combina dos valores.
+	 * @return El resultado de combinar todos los valores.
+	 */
+	template <typename ExecutionPolicy, typename RandomAccessIterator, typename ValueType,
+		typename BinaryOperation, typename = std::enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+	ValueType reduce(ExecutionPolicy&& policy, RandomAccessIterator first, RandomAccessIterator last,
+		ValueType init, BinaryOperation operation)
+	{
+		const auto bounds = execution_bounds(policy, first, last, MY_PARALLEL_MIN_GRAIN);
+		if (bounds.size() == 2)
+			return mySTL::reduce(first, last, init, operation);
+
+		// Cada parte tiene al menos un elemento, que sirve como valor inicial de la parte.
+		mySTL::vector<ValueType> partials(bounds.size() - 1);
+		execute_parts(policy, bounds.size() - 1, [&](std::size_t part)
+		{
+			RandomAccessIterator part_first = bounds[part];
+			ValueType partial = *part_first;
+			partials[part] = mySTL::reduce(++part_first, bounds[part + 1], partial, operation);
+		});
+
+		for (std::size_t part = 0; part < partials.size(); ++part)
+			init = operation(init, partials[part]);
+		return init;
+	}
+
+	/**
+	 * Suma @a init y los elementos en el rango [@a first, @a last), segn @a policy.
+	 *
+	 * @param policy	La poltica de ejecucin.
+	 * @param first		Iterador a la posicin inicial de la secuencia.
+	 * @param last		Iterador a la posicin final de la secuencia.
+	 * @param init		El valor inicial.
+	 * @return La suma de todos los valores.
+	 */
+	template <typename ExecutionPolicy, typename RandomAccessIterator, typename ValueType,
+		typename = std::enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+	ValueType reduce(ExecutionPolicy&& policy, RandomAccessIterator first, RandomAccessIterator last,
+		ValueType init)
+	{
+		return mySTL::reduce(policy, first, last, init,
+			[](const ValueType& value1, const ValueType& value2) { return value1 + value2; });
+	}
+
+	/**
+	 * Cuenta los elementos en el rango [@a first, @a last) para los que @a predicate
+	 * retorna TRUE, segn @a policy.
+	 *
+	 * @param policy	La poltica de ejecucin.
+	 * @param first		Iterador a la posicin inicial de la secuencia.
+	 * @param last		Iterador a la posicin final de la secuencia.
+	 * @param predicate	Funcin que recibe un elemento y retorna un bool.
+	 * @return La cantidad de elementos que cumplen el predicado.
+	 */
+	template <typename ExecutionPolicy, typename RandomAccessIterator, typename Predicate,
+		typename = std::enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+	typename std::iterator_traits<RandomAccessIterator>::difference_type
+		count_if(ExecutionPolicy&& policy, RandomAccessIterator first, RandomAccessIterator last,
+			Predicate predicate)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		const auto bounds = execution_bounds(policy, first, last, MY_PARALLEL_MIN_GRAIN);
+
+		mySTL::vector<difference_type> partials(bounds.size() - 1);
+		execute_parts(policy, bounds.size() - 1, [&](std::size_t part)
+		{
+			partials[part] = mySTL::count_if(bounds[part], bounds[part + 1], predicate);
+		});
+
+		difference_type count = 0;
+		for (std::size_t part = 0; part < partials.size(); ++part)
+			count += partials[part];
+		return count;
+	}
+}
+
+#endif /* MY_EXECUTION_H */
@@ -0,0 +1,509 @@
+#ifndef MY_MERGE_H
+#define MY_MERGE_H
+
+#include "my_algorithm.h"
+#include "../vector/my_vector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace mySTL
+{
+	// Este encabezado contiene los algoritmos de mezcla de secuencias ordenadas: merge,
+	// inplace_merge y la mezcla de k secuencias con un rbol de perdedores. Todas las
+	// mezclas son estables: entre elementos equivalentes, primero van los de la secuencia
+	// que se recibi primero.
+
+	/**
+	 * @brief Memoria sin inicializar para guardar temporalmente elementos durante una
+	 * mezcla. Si no se puede reservar la cantidad pedida, se intenta con la mitad, y as
+	 * sucesivamente; capacity() indica cuntos elementos caben al final, que puede ser 0.
+	 *
+	 * @tparam ValueType	El tipo de los elementos.
+	 */
+	template <typename ValueType>
+	class temporary_buffer
+	{
+	// Atributos privados
+	private:
+		ValueType* storage;			// La memoria reservada, o nullptr.
+		std::size_t storage_capacity;	// Cantidad de elementos que caben.
+
+	// Mtodos pblicos
+	public:
+		/**
+		 * Reserva memoria para a lo sumo @a requested elementos.
+		 *
+		 * @param requested	La cantidad de elementos deseada.
+		 */
+		explicit temporary_buffer(std::size_t requested)
+			: storage(nullptr)
+			, storage_capacity(0)
+		{
+			const std::size_t maximum = std::size_t(PTRDIFF_MAX) / sizeof(ValueType);
+			if (requested > maximum)
+				requested = maximum;
+
+			while (requested > 0)
+			{
+				this->storage = static_cast<ValueType*>(::operator new(requested * sizeof(ValueType), std::nothrow));
+				if (this->storage != nullptr)
+				{
+					this->storage_capacity = requested;
+					break;
+				}
+				requested /= 2;
+			}
+		}
+
+		/// Libera la memoria. Los elementos ya deben estar destruidos.
+		~temporary_buffer()
+		{
+			::operator delete(this->storage);
+		}
+
+		temporary_buffer(const temporary_buffer&) = delete;
+		temporary_buffer& operator=(const temporary_buffer&) = delete;
+
+		/// Retorna un puntero al inicio de la memoria.
+		inline ValueType* data() const { return this->storage; }
+
+		/// Retorna la cantidad de elementos que caben.
+		inline std::size_t capacity() const { return this->storage_capacity; }
+	};
+
+	/**
+	 * Mezcla los rangos ordenados [@a first1, @a last1) y [@a first2, @a last2) en el rango
+	 * que empieza en @a result, que no debe traslaparse con ellos.
+	 *
+	 * @param first1, last1	Iteradores a las posiciones inicial y final de la primera secuencia.
+	 * @param first2, last2	Iteradores a las posiciones inicial y final de la segunda secuencia.
+	 * @param result		Iterador a la posicin inicial de la secuencia destino.
+	 * @param compare		Criterio de comparacin con el que se ordenaron las secuencias.
+	 * @return Iterador al final del rango destino.
+	 */
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+	OutputIterator merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+		OutputIterator result, Compare compare)
+	{
+		while (first1 != last1 && first2 != last2)
+		{
+			// Ante elementos equivalentes, primero va el de la primera secuencia.
+			if (compare(*first2, *first1))
+			{
+				*result = *first2;
+				++first2;
+			}
+			else
+			{
+				*result = *first1;
+				++first1;
+			}
+			++result;
+		}
+		result = mySTL::copy(first1, last1, result);
+		return mySTL::copy(first2, last2, result);
+	}
+
+	/**
+	 * Mezcla los rangos ordenados de forma ascendente [@a first1, @a last1) y
+	 * [@a first2, @a last2) en el rango que empieza en @a result.
+	 *
+	 * @param first1, last1	Iteradores a las posiciones inicial y final de la primera secuencia.
+	 * @param first2, last2	Iteradores a las posiciones inicial y final de la segunda secuencia.
+	 * @param result		Iterador a la posicin inicial de la secuencia destino.
+	 * @return Iterador al final del rango destino.
+	 */
+	template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
+	OutputIterator merge(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, InputIterator2 last2,
+		OutputIterator result)
+	{
+		return mySTL::merge(first1, last1, first2, last2, result,
+			[](const auto& lhs, const auto& rhs) { return lhs < rhs; });
+	}
+
+	/**
+	 * Mezcla [@a first, @a middle) y [@a middle, @a last) moviendo la parte izquierda, de
+	 * @a left_count elementos, a @a buffer y mezclando hacia adelante.
+	 */
+	template <typename RandomAccessIterator, typename ValueType, typename Compare>
+	void merge_forward_with_buffer(RandomAccessIterator first, RandomAccessIterator middle,
+		RandomAccessIterator last, ValueType* buffer, std::size_t left_count, Compare& compare)
+	{
+		ValueType* buffer_end = buffer;
+		for (RandomAccessIterator current = first; current != middle; ++current, ++buffer_end)
+			::new (static_cast<void*>(buffer_end)) ValueType(std::move(*current));
+
+		ValueType* left = buffer;
+		RandomAccessIterator right = middle;
+		RandomAccessIterator result = first;
+		while (left != buffer_end && right != last)
+		{
+			if (compare(*right, *left))
+			{
+				*result = std::move(*right);
+				++right;
+			}
+			else
+			{
+				*result = std::move(*left);
+				++left;
+			}
+			++result;
+		}
+		for (; left != buffer_end; ++left, ++result)
+			*result = std::move(*left);
+
+		for (std::size_t index = 0; index < left_count; ++index)
+			buffer[index].~ValueType();
+	}
+
+	/**
+	 * Mezcla [@a first, @a middle) y [@a middle, @a last) moviendo la parte derecha, de
+	 * @a right_count elementos, a @a buffer y mezclando hacia atrs.
+	 */
+	template <typename RandomAccessIterator, typename ValueType, typename Compare>
+	void merge_backward_with_buffer(RandomAccessIterator first, RandomAccessIterator middle,
+		RandomAccessIterator last, ValueType* buffer, std::size_t right_count, Compare& compare)
+	{
+		ValueType* buffer_end = buffer;
+		for (RandomAccessIterator current = middle; current != last; ++current, ++buffer_end)
+			::new (static_cast<void*>(buffer_end)) ValueType(std::move(*current));
+
+		RandomAccessIterator left = middle;
+		ValueType* right = buffer_end;
+		RandomAccessIterator result = last;
+		while (left != first && right != buffer)
+		{
+			// Hacia atrs, ante elementos equivalentes primero se coloca el de la derecha.
+			if (compare(*(right - 1), *(left - 1)))
+				*--result = std::move(*--left);
+			else
+				*--result = std::move(*--right);
+		}
+		while (right != buffer)
+			*--result = std::move(*--right);
+
+		for (std::size_t index = 0; index < right_count; ++index)
+			buffer[index].~ValueType();
+	}
+
+	/**
+	 * Mezcla los rangos ordenados consecutivos [@a first, @a middle) y [@a middle, @a last)
+	 * usando @a buffer, con espacio para @a buffer_size elementos, si la parte ms pequea
+	 * cabe en l. Si no cabe, divide el problema en dos: busca con bsqueda binaria dnde
+	 * cortar cada parte, rota el trozo entre los cortes y mezcla cada mitad por aparte.
+	 * Con @a buffer_size igual a 0 la mezcla se hace sin memoria adicional en
+	 * O(n log n).
+	 *
+	 * @param first, middle, last	Iteradores a los lmites de los rangos.
+	 * @param left_count			La cantidad de elementos en [@a first, @a middle).
+	 * @param right_count			La cantidad de elementos en [@a middle, @a last).
+	 * @param buffer				Memoria sin inicializar para mover elementos.
+	 * @param buffer_size			La cantidad de elementos que caben en @a buffer.
+	 * @param compare				Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename ValueType, typename Compare>
+	void merge_adaptive(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+		std::size_t left_count, std::size_t right_count, ValueType* buffer, std::size_t buffer_size,
+		Compare& compare)
+	{
+		for (;;)
+		{
+			if (left_count == 0 || right_count == 0)
+				return;
+
+			if (left_count + right_count == 2)
+			{
+				if (compare(*middle, *first))
+					std::iter_swap(first, middle);
+				return;
+			}
+
+			if (left_count <= right_count && left_count <= buffer_size)
+			{
+				merge_forward_with_buffer(first, middle, last, buffer, left_count, compare);
+				return;
+			}
+			if (right_count <= buffer_size)
+			{
+				merge_backward_with_buffer(first, middle, last, buffer, right_count, compare);
+				return;
+			}
+
+			// Cortar la parte ms grande por la mitad y la otra donde ira ese elemento.
+			RandomAccessIterator left_cut;
+			RandomAccessIterator right_cut;
+			std::size_t left_cut_count;
+			std::size_t right_cut_count;
+			if (left_count > right_count)
+			{
+				left_cut_count = left_count / 2;
+				left_cut = first + left_cut_count;
+				right_cut = mySTL::lower_bound(middle, last, *left_cut, compare);
+				right_cut_count = std::size_t(right_cut - middle);
+			}
+			else
+			{
+				right_cut_count = right_count / 2;
+				right_cut = middle + right_cut_count;
+				left_cut = mySTL::upper_bound(first, middle, *right_cut, compare);
+				left_cut_count = std::size_t(left_cut - first);
+			}
+
+			// [left_cut, middle) y [middle, right_cut) cambian de lugar.
+			RandomAccessIterator new_middle = mySTL::rotate(left_cut, middle, right_cut);
+
+			// Mezclar la mitad izquierda recursivamente y seguir con la derecha.
+			merge_adaptive(first, left_cut, new_middle, left_cut_count, right_cut_count, buffer, buffer_size,
+				compare);
+			first = new_middle;
+			middle = right_cut;
+			left_count -= left_cut_count;
+			right_count -= right_cut_count;
+		}
+	}
+
+	/**
+	 * Mezcla los rangos ordenados consecutivos [@a first, @a middle) y [@a middle, @a last),
+	 * de manera que [@a first, @a last) quede ordenado. Intenta reservar memoria para la
+	 * parte ms pequea; si no se puede, usa la memoria que consiga, o ninguna.
+	 *
+	 * @param first		Iterador a la posicin inicial de la primera secuencia.
+	 * @param middle	Iterador a la posicin final de la primera secuencia y la inicial de la segunda.
+	 * @param last		Iterador a la posicin final de la segunda secuencia.
+	 * @param compare	Criterio de comparacin con el que se ordenaron las secuencias.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void inplace_merge(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+		Compare compare)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+		const std::size_t left_count = std::size_t(middle - first);
+		const std::size_t right_count = std::size_t(last - middle);
+		if (left_count == 0 || right_count == 0)
+			return;
+
+		temporary_buffer<value_type> buffer(left_count < right_count ? left_count : right_count);
+		merge_adaptive(first, middle, last, left_count, right_count, buffer.data(), buffer.capacity(), compare);
+	}
+
+	/**
+	 * Mezcla los rangos ordenados de forma ascendente consecutivos [@a first, @a middle) y
+	 * [@a middle, @a last).
+	 *
+	 * @param first		Iterador a la posicin inicial de la primera secuencia.
+	 * @param middle	Iterador a la posicin final de la primera secuencia y la inicial de la segunda.
+	 * @param last		Iterador a la posicin final de la segunda secuencia.
+	 */
+	template <typename RandomAccessIterator>
+	void inplace_merge(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+	{
+		mySTL::inplace_merge(first, middle, last,
+			std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	/**
+	 * @brief rbol de perdedores (tournament tree) para mezclar k secuencias ordenadas.
+	 *
+	 * Cada hoja es una secuencia de entrada y cada nodo interno guarda el perdedor de la
+	 * comparacin entre los ganadores de sus dos subrboles; la raz guarda el ganador
+	 * total. Al avanzar la secuencia ganadora, su nuevo elemento solo se compara con los
+	 * perdedores en el camino hacia la raz: log2(k) comparaciones por elemento, sin
+	 * intercambios como en un montculo, y siempre con los mismos nodos, que se quedan
+	 * en la cach. Entre elementos equivalentes gana la secuencia con el menor ndice,
+	 * as que la mezcla es estable. El rbol guarda una copia del elemento actual de cada
+	 * secuencia para compararlas sin seguir los iteradores, as que los elementos deben
+	 * poder construirse por defecto y copiarse.
+	 *
+	 * @tparam InputIterator	El tipo de iterador de las secuencias.
+	 * @tparam Compare			Criterio de comparacin con el que se ordenaron.
+	 */
+	template <typename InputIterator, typename Compare = std::less<typename std::iterator_traits<InputIterator>::value_type>>
+	class loser_tree
+	{
+	// Tipos miembro pblicos
+	public:
+		// Tipo de los elementos de las secuencias.
+		typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+		// Referencia al elemento actual de una secuencia.
+		typedef typename std::iterator_traits<InputIterator>::reference reference;
+		// Tipo entero sin signo.
+		typedef std::size_t size_type;
+
+	// Atributos privados
+	private:
+		mySTL::vector<InputIterator> current;	// Posicin actual de cada secuencia.
+		mySTL::vector<InputIterator> last;		// Posicin final de cada secuencia.
+		mySTL::vector<value_type> keys;			// Copia del elemento actual de cada secuencia.
+		mySTL::vector<unsigned char> done;		// Indica si cada hoja ya no tiene elementos.
+		mySTL::vector<size_type> nodes;			// nodes[0] es el ganador; nodes[1..leaves) son perdedores.
+		size_type leaves;						// Cantidad de hojas: la potencia de 2 mayor o igual que k.
+		Compare compare;						// Criterio de comparacin.
+
+	// Mtodos pblicos
+	public:
+		/**
+		 * Construye el rbol a partir de un rango de pares de iteradores.
+		 *
+		 * @param first_range, last_range	Iteradores a los lmites de un rango de
+		 * secuencias. Cada elemento tiene miembros first y second con las posiciones
+		 * inicial y final de una secuencia, como std::pair.
+		 * @param compare					Criterio de comparacin.
+		 */
+		template <typename RangeIterator>
+		loser_tree(RangeIterator first_range, RangeIterator last_range, Compare compare = Compare())
+			: current()
+			, last()
+			, keys()
+			, done()
+			, nodes()
+			, leaves(1)
+			, compare(compare)
+		{
+			for (; first_range != last_range; ++first_range)
+			{
+				this->current.push_back((*first_range).first);
+				this->last.push_back((*first_range).second);
+			}
+			while (this->leaves < this->current.size())
+				this->leaves *= 2;
+
+			// Las hojas de relleno, despus de las k secuencias, no tienen elementos.
+			this->keys.resize(this->leaves, value_type());
+			this->done.resize(this->leaves, 1);
+			for (size_type source = 0; source < this->current.size(); ++source)
+			{
+				this->done[source] = (this->current[source] == this->last[source]);
+				if (!this->done[source])
+					this->keys[source] = *this->current[source];
+			}
+
+			// Jugar el torneo de abajo hacia arriba. winners[n] es el ganador del
+			// subrbol con raz en n; las hojas son winners[leaves..2 * leaves).
+			mySTL::vector<size_type> winners(2 * this->leaves, 0);
+			for (size_type leaf = 0; leaf < this->leaves; ++leaf)
+				winners[this->leaves + leaf] = leaf;
+
+			this->nodes.resize(this->leaves, 0);
+			for (size_type node = this->leaves - 1; node > 0; --node)
+			{
+				const size_type left = winners[2 * node];
+				const size_type right = winners[2 * node + 1];
+				if (this->beats(right, left))
+				{
+					winners[node] = right;
+					this->nodes[node] = left;
+				}
+				else
+				{
+					winners[node] = left;
+					this->nodes[node] = right;
+				}
+			}
+			this->nodes[0] = winners[1];
+		}
+
+		/// Verifica si ya no quedan elementos en ninguna secuencia.
+		inline bool empty() const { return this->done[this->nodes[0]] != 0; }
+
+		/// Retorna el menor elemento pendiente. El rbol no debe estar vaco.
+		inline reference top() const { return *this->current[this->nodes[0]]; }
+
+		/// Retorna el ndice de la secuencia que tiene el menor elemento pendiente.
+		inline size_type top_source() const { return this->nodes[0]; }
+
+		/// Avanza la secuencia del menor elemento pendiente. El rbol no debe estar vaco.
+		void pop()
+		{
+			size_type winner = this->nodes[0];
+			if (++this->current[winner] == this->last[winner])
+				this->done[winner] = 1;
+			else
+				this->keys[winner] = *this->current[winner];
+
+			// Repetir las comparaciones en el camino de la hoja a la raz. El intercambio
+			// se hace con una mscara en lugar de un salto, porque el resultado de la
+			// comparacin es impredecible.
+			for (size_type node = (this->leaves + winner) / 2; node > 0; node /= 2)
+			{
+				const size_type loser = this->nodes[node];
+				const size_type mask = size_type(0) - size_type(this->beats(loser, winner));
+				const size_type difference = (loser ^ winner) & mask;
+				this->nodes[node] = loser ^ difference;
+				winner ^= difference;
+			}
+			this->nodes[0] = winner;
+		}
+
+	// Mtodos privados
+	private:
+		/**
+		 * Verifica si el elemento actual de @a lhs va antes que el de @a rhs. Una hoja sin
+		 * elementos pierde siempre, y entre elementos equivalentes gana el menor ndice.
+		 * Las claves se comparan aunque la hoja no tenga elementos (conservan el ltimo
+		 * valor), para combinar los resultados con operaciones de bits en lugar de saltos.
+		 */
+		inline bool beats(size_type lhs, size_type rhs) const
+		{
+			bool ordered;
+			if constexpr (std::is_arithmetic_v<value_type> && is_default_compare_v<Compare, value_type>)
+			{
+				// Comparar es barato: hacer las dos comparaciones evita saltar segn el ndice.
+				const bool less = this->compare(this->keys[lhs], this->keys[rhs]);
+				const bool greater = this->compare(this->keys[rhs], this->keys[lhs]);
+				ordered = less | (!greater && lhs < rhs);
+			}
+			else
+				ordered = (lhs < rhs) ? !this->compare(this->keys[rhs], this->keys[lhs])
+					: this->compare(this->keys[lhs], this->keys[rhs]);
+			return (this->done[lhs] == 0) & ((this->done[rhs] != 0) | ordered);
+		}
+	};
+
+	/**
+	 * Mezcla varias secuencias ordenadas en el rango que empieza en @a result, con un
+	 * rbol de perdedores. Las secuencias se leen una sola vez y en orden, as que pueden
+	 * ser flujos de entrada.
+	 *
+	 * @param first_range, last_range	Iteradores a los lmites de un rango de pares de
+	 * iteradores (miembros first y second), uno por secuencia.
+	 * @param result					Iterador a la posicin inicial de la secuencia destino.
+	 * @param compare					Criterio de comparacin con el que se ordenaron.
+	 * @return Iterador al final del rango destino.
+	 */
+	template <typename RangeIterator, typename OutputIterator, typename Compare>
+	OutputIterator multiway_merge(RangeIterator first_range, RangeIterator last_range, OutputIterator result,
+		Compare compare)
+	{
+		typedef decltype((*first_range).first) input_iterator;
+		loser_tree<std::decay_t<input_iterator>, Compare> tree(first_range, last_range, compare);
+		for (; !tree.empty(); tree.pop(), ++result)
+			*result = tree.top();
+		return result;
+	}
+
+	/**
+	 * Mezcla varias secuencias ordenadas de forma ascendente en el rango que empieza en
+	 * @a result.
+	 *
+	 * @param first_range, last_range	Iteradores a los lmites de un rango de pares de
+	 * iteradores (miembros first y second), uno por secuencia.
+	 * @param result					Iterador a la posicin inicial de la secuencia destino.
+	 * @return Iterador al final del rango destino.
+	 */
+	template <typename RangeIterator, typename OutputIterator>
+	OutputIterator multiway_merge(RangeIterator first_range, RangeIterator last_range, OutputIterator result)
+	{
+		typedef std::decay_t<decltype((*first_range).first)> input_iterator;
+		return mySTL::multiway_merge(first_range, last_range, result,
+			std::less<typename std::iterator_traits<input_iterator>::value_type>());
+	}
+}
+
+#endif /* MY_MERGE_H */
@@ -0,0 +1,368 @@
+#ifndef MY_RADIX_SORT_H
+#define MY_RADIX_SORT_H
+
+#include "my_sort.h"
+#include "my_execution.h"
+#include "../vector/my_vector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+// Cantidad de elementos por debajo de la cual radix_sort ordena por insercin: con pocos
+// elementos, recorrer los histogramas cuesta ms que ordenar.
+#ifndef MY_RADIX_SORT_INSERTION_THRESHOLD
+#define MY_RADIX_SORT_INSERTION_THRESHOLD std::size_t(64)
+#endif
+
+namespace mySTL
+{
+	// Este encabezado contiene radix_sort, un ordenamiento por dgitos para claves enteras,
+	// de punto flotante o enumeraciones en arreglos contiguos. La versin secuencial es LSD:
+	// ordena de forma estable por cada dgito, del menos al ms significativo. La versin
+	// paralela es MSD en el primer dgito: reparte los elementos en cubetas segn el dgito
+	// ms significativo y despus ordena cada cubeta con LSD en un hilo distinto.
+
+	/**
+	 * Convierte una clave en un entero sin signo del mismo tamao, de manera que el orden
+	 * de los enteros sin signo sea el orden de las claves.
+	 *
+	 * - Los enteros con signo invierten el bit de signo, as los negativos quedan antes.
+	 * - Los nmeros de punto flotante invierten todos los bits si son negativos (para que
+	 * el mayor en valor absoluto quede antes) y solo el bit de signo si no lo son. -0.0
+	 * queda antes que 0.0; los NaN negativos quedan al inicio y los positivos al final.
+	 * - Las enumeraciones usan su tipo subyacente.
+	 *
+	 * @param key	La clave.
+	 * @return el entero sin signo que la representa.
+	 */
+	template <typename KeyType>
+	inline auto to_radix_key(KeyType key) noexcept
+	{
+		static_assert(std::is_arithmetic_v<KeyType> || std::is_enum_v<KeyType>,
+			"mySTL::radix_sort: la clave debe ser un entero, un nmero de punto flotante o una enumeracin");
+
+		if constexpr (std::is_enum_v<KeyType>)
+			return to_radix_key(static_cast<std::underlying_type_t<KeyType>>(key));
+		else if constexpr (std::is_floating_point_v<KeyType>)
+		{
+			static_assert(sizeof(KeyType) == 4 || sizeof(KeyType) == 8,
+				"mySTL::radix_sort: solo se ordenan float y double");
+			typedef std::conditional_t<sizeof(KeyType) == 4, std::uint32_t, std::uint64_t> unsigned_type;
+			const unsigned_type sign_bit = unsigned_type(1) << (8 * sizeof(KeyType) - 1);
+
+			unsigned_type bits;
+			std::memcpy(&bits, &key, sizeof(KeyType));
+			return (bits & sign_bit) ? unsigned_type(~bits) : unsigned_type(bits | sign_bit);
+		}
+		else
+		{
+			static_assert(!std::is_same_v<KeyType, bool>, "mySTL::radix_sort: no se ordenan claves bool");
+			typedef std::make_unsigned_t<KeyType> unsigned_type;
+			if constexpr (std::is_signed_v<KeyType>)
+				return unsigned_type(unsigned_type(key) ^ (unsigned_type(1) << (8 * sizeof(KeyType) - 1)));
+			else
+				return unsigned_type(key);
+		}
+	}
+
+	/**
+	 * Retorna la cantidad de bits por dgito para ordenar @a count elementos por los
+	 * @a bits bits menos significativos de una clave de @a key_size bytes. Las claves de 1
+	 * o 2 bytes y los arreglos de menos de 4096 elementos usan dgitos de 8 bits, porque
+	 * recorrer histogramas grandes costara ms que las pasadas que se ahorran; los dems
+	 * usan dgitos de hasta 11 bits, cuyo histograma de 2048 contadores todava cabe en la
+	 * cach L1. Los bits se reparten de forma pareja entre las pasadas: 32 bits son 3
+	 * pasadas de 11 bits en lugar de 4 de 8.
+	 */
+	constexpr unsigned radix_digit_bits(std::size_t key_size, unsigned bits, std::size_t count) noexcept
+	{
+		const unsigned max_digit = (key_size <= 2 || count < 4096) ? 8 : 11;
+		const unsigned passes = (bits + max_digit - 1) / max_digit;
+		return (passes == 0) ? 0 : (bits + passes - 1) / passes;
+	}
+
+	/**
+	 * Mueve los elementos de [@a first, @a last) a @a result. Con tipos trivialmente
+	 * copiables es un memmove.
+	 */
+	template <typename ValueType>
+	inline void radix_move(ValueType* first, ValueType* last, ValueType* result)
+	{
+		if constexpr (std::is_trivially_copyable_v<ValueType>)
+			mySTL::copy(first, last, result);
+		else
+			for (; first != last; ++first, ++result)
+				*result = std::move(*first);
+	}
+
+	/**
+	 * Ordena de forma estable los @a count elementos de @a data por los @a bits bits menos
+	 * significativos de su clave. Los bits ms significativos deben ser iguales en todos
+	 * los elementos.
+	 *
+	 * Se hace una sola lectura para calcular los histogramas de todos los dgitos. Despus
+	 * cada pasada reparte los elementos entre @a data y @a buffer segn un dgito; las
+	 * pasadas cuyo dgito es igual en todos los elementos se omiten.
+	 *
+	 * @param data		El arreglo por ordenar.
+	 * @param buffer	Un arreglo auxiliar con espacio para @a count elementos.
+	 * @param count		La cantidad de elementos.
+	 * @param radix_key	Funcin que retorna la clave sin signo de un elemento.
+	 * @param bits		La cantidad de bits de la clave por ordenar.
+	 * @return @a data o @a buffer, el que contiene los elementos ordenados.
+	 */
+	template <typename ValueType, typename RadixKey>
+	ValueType* radix_sort_passes(ValueType* data, ValueType* buffer, std::size_t count, RadixKey& radix_key,
+		unsigned bits)
+	{
+		typedef decltype(radix_key(*data)) key_type;
+
+		if (count < 2 || bits == 0)
+			return data;
+
+		if (count < MY_RADIX_SORT_INSERTION_THRESHOLD)
+		{
+			// insertion_sort es estable: solo mueve un elemento si su clave es menor.
+			auto compare = [&radix_key](const ValueType& lhs, const ValueType& rhs)
+			{
+				return radix_key(lhs) < radix_key(rhs);
+			};
+			insertion_sort(data, data + count, compare);
+			return data;
+		}
+
+		const unsigned digit_bits = radix_digit_bits(sizeof(key_type), bits, count);
+		const unsigned passes = (bits + digit_bits - 1) / digit_bits;
+		const std::size_t buckets = std::size_t(1) << digit_bits;
+		const key_type mask = key_type(buckets - 1);
+
+		// Histogramas de todos los dgitos en una sola lectura.
+		mySTL::vector<std::size_t> histograms(passes * buckets, 0);
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			const key_type key = radix_key(data[index]);
+			for (unsigned pass = 0; pass < passes; ++pass)
+				++histograms[pass * buckets + ((key >> (pass * digit_bits)) & mask)];
+		}
+
+		ValueType* source = data;
+		ValueType* destination = buffer;
+		for (unsigned pass = 0; pass < passes; ++pass)
+		{
+			std::size_t* histogram = histograms.data() + pass * buckets;
+			const unsigned shift = pass * digit_bits;
+
+			// Si todos los elementos tienen el mismo dgito, la pasada no cambia nada.
+			if (histogram[(radix_key(*source) >> shift) & mask] == count)
+				continue;
+
+			// Convertir el histograma en la posicin inicial de cada cubeta.
+			std::size_t offset = 0;
+			for (std::size_t bucket = 0; bucket < buckets; ++bucket)
+			{
+				const std::size_t bucket_count = histogram[bucket];
+				histogram[bucket] = offset;
+				offset += bucket_count;
+			}
+
+			for (std::size_t index = 0; index < count; ++index)
+				destination[histogram[(radix_key(source[index]) >> shift) & mask]++] = std::move(source[index]);
+
+			std::swap(source, destination);
+		}
+		return source;
+	}
+
+	/**
+	 * Ordena de forma estable los elementos en [@a first, @a last) segn la clave que
+	 * retorna @a key para cada uno. Toma O(n) por cada dgito de la clave y usa un arreglo
+	 * auxiliar de n elementos, as que el tipo de los elementos debe poder construirse por
+	 * defecto y moverse.
+	 *
+	 * @param first	Puntero a la posicin inicial del arreglo.
+	 * @param last	Puntero a la posicin final del arreglo.
+	 * @param key	Funcin que recibe un elemento y retorna su clave: un entero, un float,
+	 * un double o una enumeracin. Se llama varias veces por elemento.
+	 */
+	template <typename ValueType, typename KeyFunction>
+	void radix_sort(ValueType* first, ValueType* last, KeyFunction key)
+	{
+		auto radix_key = [&key](const ValueType& value) { return to_radix_key(key(value)); };
+		typedef decltype(radix_key(*first)) key_type;
+
+		const std::size_t count = std::size_t(last - first);
+		if (count < MY_RADIX_SORT_INSERTION_THRESHOLD)
+		{
+			radix_sort_passes(first, first, count, radix_key, 8 * sizeof(key_type));
+			return;
+		}
+
+		mySTL::vector<ValueType> buffer(count);
+		ValueType* result = radix_sort_passes(first, buffer.data(), count, radix_key, 8 * sizeof(key_type));
+		if (result != first)
+			radix_move(result, result + count, first);
+	}
+
+	/**
+	 * Ordena de forma ascendente los elementos en [@a first, @a last), que deben ser
+	 * enteros, float, double o enumeraciones.
+	 *
+	 * @param first	Puntero a la posicin inicial del arreglo.
+	 * @param last	Puntero a la posicin final del arreglo.
+	 */
+	template <typename ValueType>
+	void radix_sort(ValueType* first, ValueType* last)
+	{
+		mySTL::radix_sort(first, last, [](const ValueType& value) { return value; });
+	}
+
+	/**
+	 * Ordena de forma estable los elementos en [@a first, @a last) segn la clave que
+	 * retorna @a key, segn @a policy.
+	 *
+	 * La versin paralela calcula primero qu bits de la clave cambian entre elementos y
+	 * toma como primer dgito los ms significativos de ellos. Cada parte del arreglo
+	 * cuenta sus elementos por cubeta de ese dgito y los copia al arreglo auxiliar en la
+	 * posicin que le corresponde, de manera que se conserva el orden original dentro de
+	 * cada cubeta. Despus las cubetas se agrupan en tantas partes de tamao parecido como
+	 * hilos, y cada parte ordena sus cubetas con radix_sort_passes por los bits restantes.
+	 *
+	 * @param policy	La poltica de ejecucin.
+	 * @param first		Puntero a la posicin inicial del arreglo.
+	 * @param last		Puntero a la posicin final del arreglo.
+	 * @param key		Funcin que recibe un elemento y retorna su clave. Se llama desde
+	 * varios hilos a la vez.
+	 */
+	template <typename ExecutionPolicy, typename ValueType, typename KeyFunction,
+		typename = std::enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+	void radix_sort(ExecutionPolicy&& policy, ValueType* first, ValueType* last, KeyFunction key)
+	{
+		auto radix_key = [&key](const ValueType& value) { return to_radix_key(key(value)); };
+		typedef decltype(radix_key(*first)) key_type;
+
+		const auto bounds = execution_bounds(policy, first, last, memory_grain<ValueType>());
+		const std::size_t parts = bounds.size() - 1;
+		if (parts == 1)
+		{
+			mySTL::radix_sort(first, last, key);
+			return;
+		}
+
+		// Calcular qu bits cambian: los que estn en el OR de las claves pero no en el AND.
+		mySTL::vector<key_type> part_or(parts, key_type(0));
+		mySTL::vector<key_type> part_and(parts, key_type(~key_type(0)));
+		execute_parts(policy, parts, [&](std::size_t part)
+		{
+			key_type bits_or = 0;
+			key_type bits_and = key_type(~key_type(0));
+			for (ValueType* current = bounds[part]; current != bounds[part + 1]; ++current)
+			{
+				const key_type current_key = radix_key(*current);
+				bits_or |= current_key;
+				bits_and &= current_key;
+			}
+			part_or[part] = bits_or;
+			part_and[part] = bits_and;
+		});
+
+		key_type bits_or = 0;
+		key_type bits_and = key_type(~key_type(0));
+		for (std::size_t part = 0; part < parts; ++part)
+		{
+			bits_or |= part_or[part];
+			bits_and &= part_and[part];
+		}
+		const key_type changing = key_type(bits_or ^ bits_and);
+		if (changing == 0)
+			return; // Todas las claves son iguales.
+
+		// El primer dgito son los bits ms significativos que cambian.
+		unsigned bits = 0;
+		while (bits < 8 * sizeof(key_type) && (changing >> bits) != 0)
+			++bits;
+		const unsigned digit_bits = (bits < 11) ? bits : 11;
+		const unsigned shift = bits - digit_bits;
+		const std::size_t buckets = std::size_t(1) << digit_bits;
+		const key_type mask = key_type(buckets - 1);
+
+		// Histograma de cada parte.
+		mySTL::vector<std::size_t> offsets(parts * buckets, 0);
+		execute_parts(policy, parts, [&](std::size_t part)
+		{
+			std::size_t* histogram = offsets.data() + part * buckets;
+			for (ValueType* current = bounds[part]; current != bounds[part + 1]; ++current)
+				++histogram[(radix_key(*current) >> shift) & mask];
+		});
+
+		// Posicin inicial de cada parte en cada cubeta: primero por cubeta y despus por
+		// parte, para que el reparto sea estable.
+		mySTL::vector<std::size_t> bucket_start(buckets + 1, 0);
+		std::size_t offset = 0;
+		for (std::size_t bucket = 0; bucket < buckets; ++bucket)
+		{
+			bucket_start[bucket] = offset;
+			for (std::size_t part = 0; part < parts; ++part)
+			{
+				const std::size_t bucket_count = offsets[part * buckets + bucket];
+				offsets[part * buckets + bucket] = offset;
+				offset += bucket_count;
+			}
+		}
+		bucket_start[buckets] = offset;
+
+		mySTL::vector<ValueType> buffer(std::size_t(last - first));
+		ValueType* const scratch = buffer.data();
+		execute_parts(policy, parts, [&](std::size_t part)
+		{
+			std::size_t* part_offsets = offsets.data() + part * buckets;
+			for (ValueType* current = bounds[part]; current != bounds[part + 1]; ++current)
+				scratch[part_offsets[(radix_key(*current) >> shift) & mask]++] = std::move(*current);
+		});
+
+		// Agrupar las cubetas en partes con una cantidad parecida de elementos.
+		const std::size_t count = std::size_t(last - first);
+		mySTL::vector<std::size_t> groups;
+		groups.reserve(parts + 1);
+		groups.push_back(0);
+		for (std::size_t bucket = 1; bucket < buckets; ++bucket)
+			if (bucket_start[bucket] >= count * groups.size() / parts && groups.size() < parts)
+				groups.push_back(bucket);
+		groups.push_back(buckets);
+
+		// Ordenar cada cubeta por los bits restantes, usando su espacio en el arreglo
+		// original como arreglo auxiliar, y dejar el resultado en el arreglo original.
+		execute_parts(policy, groups.size() - 1, [&](std::size_t group)
+		{
+			for (std::size_t bucket = groups[group]; bucket < groups[group + 1]; ++bucket)
+			{
+				const std::size_t bucket_first = bucket_start[bucket];
+				const std::size_t bucket_count = bucket_start[bucket + 1] - bucket_first;
+				ValueType* result = radix_sort_passes(scratch + bucket_first, first + bucket_first,
+					bucket_count, radix_key, shift);
+				if (result != first + bucket_first)
+					radix_move(result, result + bucket_count, first + bucket_first);
+			}
+		});
+	}
+
+	/**
+	 * Ordena de forma ascendente los elementos en [@a first, @a last), que deben ser
+	 * enteros, float, double o enumeraciones, segn @a policy.
+	 *
+	 * @param policy	La poltica de ejecucin.
+	 * @param first		Puntero a la posicin inicial del arreglo.
+	 * @param last		Puntero a la posicin final del arreglo.
+	 */
+	template <typename ExecutionPolicy, typename ValueType,
+		typename = std::enable_if_t<is_execution_policy_v<ExecutionPolicy>>>
+	void radix_sort(ExecutionPolicy&& policy, ValueType* first, ValueType* last)
+	{
+		mySTL::radix_sort(std::forward<ExecutionPolicy>(policy), first, last,
+			[](const ValueType& value) { return value; });
+	}
+}
+
+#endif /* MY_RADIX_SORT_H */
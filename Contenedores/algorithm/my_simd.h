@@ -0,0 +1,613 @@
+#ifndef MY_SIMD_H
+#define MY_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define MY_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+// Tamao en bytes a partir del cual fill escribe con instrucciones no temporales, que no
+// pasan por la cach. Debe ser mayor que la cach de ltimo nivel: si el bloque cabe en
+// ella, conviene dejarlo ah para quien lo lea despus.
+#ifndef MY_NONTEMPORAL_THRESHOLD
+#define MY_NONTEMPORAL_THRESHOLD (std::size_t(16) << 20)
+#endif
+
+namespace mySTL
+{
+	// Este encabezado contiene las rutinas vectorizadas que usan los algoritmos de
+	// my_algorithm.h para rangos contiguos de tipos simples. Las rutinas para x86-64 se
+	// compilan con atributos target, de manera que no hace falta compilar todo el programa
+	// con -mavx2: el conjunto de instrucciones se elige en tiempo de ejecucin.
+
+	/// Los conjuntos de instrucciones vectoriales que se pueden usar.
+	enum class simd_level
+	{
+		scalar,	// Sin instrucciones vectoriales.
+		sse2,	// Registros de 16 bytes. Siempre disponible en x86-64.
+		avx2	// Registros de 32 bytes.
+	};
+
+	/**
+	 * Retorna el mejor conjunto de instrucciones vectoriales del procesador. La consulta
+	 * se hace una sola vez.
+	 */
+	inline simd_level detect_simd_level() noexcept
+	{
+#ifdef MY_SIMD_X86
+		static const simd_level level = __builtin_cpu_supports("avx2") ? simd_level::avx2 : simd_level::sse2;
+		return level;
+#else
+		return simd_level::scalar;
+#endif
+	}
+
+	/**
+	 * Asigna @a value a los elementos en [@a first, @a last), uno por uno.
+	 *
+	 * @param first, last	Punteros a las posiciones inicial y final de la secuencia.
+	 * @param value			El valor por asignar.
+	 */
+	template <typename ValueType>
+	inline void scalar_fill(ValueType* first, ValueType* last, ValueType value) noexcept
+	{
+		for (; first != last; ++first)
+			*first = value;
+	}
+
+#ifdef MY_SIMD_X86
+	/**
+	 * Rellena [@a first, @a last) con registros de 16 bytes que repiten @a value. Los
+	 * elementos antes de la primera direccin alineada y los que no completan un registro
+	 * se asignan uno por uno.
+	 *
+	 * @param first, last	Punteros a las posiciones inicial y final de la secuencia.
+	 * @param value			El valor por asignar. Su tamao debe ser 2, 4 u 8 bytes.
+	 * @param nontemporal	Si es TRUE, las escrituras no pasan por la cach.
+	 */
+	template <typename ValueType>
+	void sse2_fill(ValueType* first, ValueType* last, ValueType value, bool nontemporal) noexcept
+	{
+		// Avanzar elemento por elemento hasta una direccin mltiplo de 16.
+		while (first != last && (reinterpret_cast<std::uintptr_t>(first) & 15) != 0)
+			*first++ = value;
+
+		alignas(16) ValueType pattern[16 / sizeof(ValueType)];
+		scalar_fill(pattern, pattern + 16 / sizeof(ValueType), value);
+		const __m128i block = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern));
+
+		__m128i* current = reinterpret_cast<__m128i*>(first);
+		__m128i* const end = current + (std::size_t(last - first) * sizeof(ValueType)) / 16;
+		if (nontemporal)
+		{
+			for (; current != end; ++current)
+				_mm_stream_si128(current, block);
+			_mm_sfence(); // Ordenar las escrituras no temporales antes de las siguientes.
+		}
+		else
+			for (; current != end; ++current)
+				_mm_store_si128(current, block);
+
+		scalar_fill(reinterpret_cast<ValueType*>(end), last, value);
+	}
+
+	/**
+	 * Rellena [@a first, @a last) con registros de 32 bytes que repiten @a value. Igual
+	 * que sse2_fill, pero con instrucciones AVX2.
+	 *
+	 * @param first, last	Punteros a las posiciones inicial y final de la secuencia.
+	 * @param value			El valor por asignar. Su tamao debe ser 2, 4 u 8 bytes.
+	 * @param nontemporal	Si es TRUE, las escrituras no pasan por la cach.
+	 */
+	template <typename ValueType>
+	__attribute__((target("avx2")))
+	void avx2_fill(ValueType* first, ValueType* last, ValueType value, bool nontemporal) noexcept
+	{
+		while (first != last && (reinterpret_cast<std::uintptr_t>(first) & 31) != 0)
+			*first++ = value;
+
+		alignas(32) ValueType pattern[32 / sizeof(ValueType)];
+		scalar_fill(pattern, pattern + 32 / sizeof(ValueType), value);
+		const __m256i block = _mm256_load_si256(reinterpret_cast<const __m256i*>(pattern));
+
+		__m256i* current = reinterpret_cast<__m256i*>(first);
+		__m256i* const end = current + (std::size_t(last - first) * sizeof(ValueType)) / 32;
+		if (nontemporal)
+		{
+			for (; current != end; ++current)
+				_mm256_stream_si256(current, block);
+			_mm_sfence();
+		}
+		else
+			for (; current != end; ++current)
+				_mm256_store_si256(current, block);
+
+		scalar_fill(reinterpret_cast<ValueType*>(end), last, value);
+	}
+#endif
+
+#ifdef MY_SIMD_X86
+	/**
+	 * Busca el primer byte distinto entre dos bloques, comparando 16 bytes a la vez.
+	 *
+	 * @param first1, first2	Punteros al inicio de los bloques.
+	 * @param bytes				El tamao en bytes de los bloques.
+	 * @return la posicin del primer byte distinto, o @a bytes si los bloques son iguales.
+	 */
+	inline std::size_t sse2_mismatch(const unsigned char* first1, const unsigned char* first2,
+		std::size_t bytes) noexcept
+	{
+		std::size_t index = 0;
+		// Revisar 64 bytes con una sola mscara; si hay alguna diferencia, se busca abajo.
+		for (; index + 64 <= bytes; index += 64)
+		{
+			const __m128i* blocks1 = reinterpret_cast<const __m128i*>(first1 + index);
+			const __m128i* blocks2 = reinterpret_cast<const __m128i*>(first2 + index);
+			const __m128i equal = _mm_and_si128(
+				_mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128(blocks1), _mm_loadu_si128(blocks2)),
+					_mm_cmpeq_epi8(_mm_loadu_si128(blocks1 + 1), _mm_loadu_si128(blocks2 + 1))),
+				_mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128(blocks1 + 2), _mm_loadu_si128(blocks2 + 2)),
+					_mm_cmpeq_epi8(_mm_loadu_si128(blocks1 + 3), _mm_loadu_si128(blocks2 + 3))));
+			if (_mm_movemask_epi8(equal) != 0xFFFF)
+				break;
+		}
+		for (; index + 16 <= bytes; index += 16)
+		{
+			const __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first1 + index));
+			const __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first2 + index));
+			// Un bit por byte: 1 si los bytes son iguales.
+			const unsigned int equal_mask = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(block1, block2)));
+			if (equal_mask != 0xFFFF)
+				return index + std::size_t(__builtin_ctz(~equal_mask));
+		}
+		for (; index < bytes; ++index)
+			if (first1[index] != first2[index])
+				return index;
+		return bytes;
+	}
+
+	/**
+	 * Busca el primer byte distinto entre dos bloques, comparando 32 bytes a la vez.
+	 * Igual que sse2_mismatch, pero con instrucciones AVX2.
+	 *
+	 * @param first1, first2	Punteros al inicio de los bloques.
+	 * @param bytes				El tamao en bytes de los bloques.
+	 * @return la posicin del primer byte distinto, o @a bytes si los bloques son iguales.
+	 */
+	__attribute__((target("avx2")))
+	inline std::size_t avx2_mismatch(const unsigned char* first1, const unsigned char* first2,
+		std::size_t bytes) noexcept
+	{
+		std::size_t index = 0;
+		for (; index + 128 <= bytes; index += 128)
+		{
+			const __m256i* blocks1 = reinterpret_cast<const __m256i*>(first1 + index);
+			const __m256i* blocks2 = reinterpret_cast<const __m256i*>(first2 + index);
+			const __m256i equal = _mm256_and_si256(
+				_mm256_and_si256(_mm256_cmpeq_epi8(_mm256_loadu_si256(blocks1), _mm256_loadu_si256(blocks2)),
+					_mm256_cmpeq_epi8(_mm256_loadu_si256(blocks1 + 1), _mm256_loadu_si256(blocks2 + 1))),
+				_mm256_and_si256(_mm256_cmpeq_epi8(_mm256_loadu_si256(blocks1 + 2), _mm256_loadu_si256(blocks2 + 2)),
+					_mm256_cmpeq_epi8(_mm256_loadu_si256(blocks1 + 3), _mm256_loadu_si256(blocks2 + 3))));
+			if (unsigned(_mm256_movemask_epi8(equal)) != 0xFFFFFFFFu)
+				break;
+		}
+		for (; index + 32 <= bytes; index += 32)
+		{
+			const __m256i block1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first1 + index));
+			const __m256i block2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first2 + index));
+			const unsigned int equal_mask = unsigned(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block1, block2)));
+			if (equal_mask != 0xFFFFFFFFu)
+				return index + std::size_t(__builtin_ctz(~equal_mask));
+		}
+		for (; index < bytes; ++index)
+			if (first1[index] != first2[index])
+				return index;
+		return bytes;
+	}
+
+	/**
+	 * Retorna un registro de 16 bytes que repite @a value.
+	 *
+	 * @param value	El valor por repetir. Su tamao debe ser 1, 2, 4 u 8 bytes.
+	 */
+	template <typename ValueType>
+	inline __m128i sse2_broadcast(ValueType value) noexcept
+	{
+		if constexpr (sizeof(ValueType) == 1)
+		{
+			std::uint8_t bits;
+			std::memcpy(&bits, &value, 1);
+			return _mm_set1_epi8(char(bits));
+		}
+		else if constexpr (sizeof(ValueType) == 2)
+		{
+			std::uint16_t bits;
+			std::memcpy(&bits, &value, 2);
+			return _mm_set1_epi16(short(bits));
+		}
+		else if constexpr (sizeof(ValueType) == 4)
+		{
+			std::uint32_t bits;
+			std::memcpy(&bits, &value, 4);
+			return _mm_set1_epi32(int(bits));
+		}
+		else
+		{
+			std::uint64_t bits;
+			std::memcpy(&bits, &value, 8);
+			return _mm_set1_epi64x((long long)(bits));
+		}
+	}
+
+	/**
+	 * Compara los elementos de dos registros de 16 bytes. SSE2 no compara enteros de 8
+	 * bytes: se comparan sus mitades de 4 bytes y se combina cada mitad con la otra.
+	 *
+	 * @tparam Width	El tamao en bytes de los elementos: 1, 2, 4 u 8.
+	 * @return un registro con todos los bytes de cada elemento igual en 0xFF, y en 0 los dems.
+	 */
+	template <std::size_t Width>
+	inline __m128i sse2_equal_elements(__m128i block1, __m128i block2) noexcept
+	{
+		if constexpr (Width == 1)
+			return _mm_cmpeq_epi8(block1, block2);
+		else if constexpr (Width == 2)
+			return _mm_cmpeq_epi16(block1, block2);
+		else if constexpr (Width == 4)
+			return _mm_cmpeq_epi32(block1, block2);
+		else
+		{
+			const __m128i halves = _mm_cmpeq_epi32(block1, block2);
+			return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+		}
+	}
+
+	/**
+	 * Busca @a value en un arreglo, comparando 64 bytes por iteracin: se revisa con una
+	 * sola mscara si alguno de los cuatro registros tiene el valor, y solo entonces se
+	 * calcula la posicin.
+	 *
+	 * @param first	Puntero al inicio del arreglo.
+	 * @param count	La cantidad de elementos.
+	 * @param value	El valor por buscar. Su tamao debe ser 1, 2, 4 u 8 bytes.
+	 * @return la posicin del primer elemento igual a @a value, o @a count si no hay.
+	 */
+	template <typename ValueType>
+	std::size_t sse2_find(const ValueType* first, std::size_t count, ValueType value) noexcept
+	{
+		constexpr std::size_t lanes = 16 / sizeof(ValueType);
+		const __m128i needle = sse2_broadcast(value);
+		const __m128i* blocks = reinterpret_cast<const __m128i*>(first);
+
+		std::size_t index = 0;
+		for (; index + 4 * lanes <= count; index += 4 * lanes, blocks += 4)
+		{
+			const __m128i equal0 = sse2_equal_elements<sizeof(ValueType)>(_mm_loadu_si128(blocks), needle);
+			const __m128i equal1 = sse2_equal_elements<sizeof(ValueType)>(_mm_loadu_si128(blocks + 1), needle);
+			const __m128i equal2 = sse2_equal_elements<sizeof(ValueType)>(_mm_loadu_si128(blocks + 2), needle);
+			const __m128i equal3 = sse2_equal_elements<sizeof(ValueType)>(_mm_loadu_si128(blocks + 3), needle);
+			const __m128i any = _mm_or_si128(_mm_or_si128(equal0, equal1), _mm_or_si128(equal2, equal3));
+			if (_mm_movemask_epi8(any) != 0)
+			{
+				// Un bit por byte de los 64 bytes: 1 si el byte es de un elemento igual.
+				const std::uint64_t mask = std::uint64_t(unsigned(_mm_movemask_epi8(equal0)))
+					| (std::uint64_t(unsigned(_mm_movemask_epi8(equal1))) << 16)
+					| (std::uint64_t(unsigned(_mm_movemask_epi8(equal2))) << 32)
+					| (std::uint64_t(unsigned(_mm_movemask_epi8(equal3))) << 48);
+				return index + std::size_t(__builtin_ctzll(mask)) / sizeof(ValueType);
+			}
+		}
+		for (; index + lanes <= count; index += lanes, ++blocks)
+		{
+			const unsigned int mask = unsigned(_mm_movemask_epi8(
+				sse2_equal_elements<sizeof(ValueType)>(_mm_loadu_si128(blocks), needle)));
+			if (mask != 0)
+				return index + std::size_t(__builtin_ctz(mask)) / sizeof(ValueType);
+		}
+		for (; index < count; ++index)
+			if (first[index] == value)
+				return index;
+		return count;
+	}
+
+	/**
+	 * Cuenta los elementos iguales a @a value en un arreglo, 16 bytes a la vez. Cada byte
+	 * de un elemento igual suma 1 a un contador de un byte; antes de que los contadores se
+	 * desborden, se suman con _mm_sad_epu8 en contadores de 8 bytes.
+	 *
+	 * @param first	Puntero al inicio del arreglo.
+	 * @param count	La cantidad de elementos.
+	 * @param value	El valor por contar. Su tamao debe ser 1, 2, 4 u 8 bytes.
+	 * @return la cantidad de elementos iguales a @a value.
+	 */
+	template <typename ValueType>
+	std::size_t sse2_count(const ValueType* first, std::size_t count, ValueType value) noexcept
+	{
+		constexpr std::size_t lanes = 16 / sizeof(ValueType);
+		const __m128i needle = sse2_broadcast(value);
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i* blocks = reinterpret_cast<const __m128i*>(first);
+
+		__m128i totals = zero;
+		std::size_t index = 0;
+		while (index + lanes <= count)
+		{
+			std::size_t rounds = (count - index) / lanes;
+			if (rounds > 255)
+				rounds = 255;
+			index += rounds * lanes;
+
+			__m128i counters = zero;
+			for (; rounds > 0; --rounds, ++blocks)
+				counters = _mm_sub_epi8(counters,
+					sse2_equal_elements<sizeof(ValueType)>(_mm_loadu_si128(blocks), needle));
+			totals = _mm_add_epi64(totals, _mm_sad_epu8(counters, zero));
+		}
+
+		alignas(16) std::uint64_t lane_totals[2];
+		_mm_store_si128(reinterpret_cast<__m128i*>(lane_totals), totals);
+		std::size_t result = std::size_t(lane_totals[0] + lane_totals[1]) / sizeof(ValueType);
+		for (; index < count; ++index)
+			result += (first[index] == value);
+		return result;
+	}
+
+	/**
+	 * Retorna un registro de 32 bytes que repite @a value.
+	 *
+	 * @param value	El valor por repetir. Su tamao debe ser 1, 2, 4 u 8 bytes.
+	 */
+	template <typename ValueType>
+	__attribute__((target("avx2")))
+	inline __m256i avx2_broadcast(ValueType value) noexcept
+	{
+		const __m128i half = sse2_broadcast(value);
+		return _mm256_broadcastsi128_si256(half);
+	}
+
+	/**
+	 * Compara los elementos de dos registros de 32 bytes.
+	 *
+	 * @tparam Width	El tamao en bytes de los elementos: 1, 2, 4 u 8.
+	 * @return un registro con todos los bytes de cada elemento igual en 0xFF, y en 0 los dems.
+	 */
+	template <std::size_t Width>
+	__attribute__((target("avx2")))
+	inline __m256i avx2_equal_elements(__m256i block1, __m256i block2) noexcept
+	{
+		if constexpr (Width == 1)
+			return _mm256_cmpeq_epi8(block1, block2);
+		else if constexpr (Width == 2)
+			return _mm256_cmpeq_epi16(block1, block2);
+		else if constexpr (Width == 4)
+			return _mm256_cmpeq_epi32(block1, block2);
+		else
+			return _mm256_cmpeq_epi64(block1, block2);
+	}
+
+	/**
+	 * Igual que sse2_find, pero con registros de 32 bytes: compara 128 bytes por iteracin.
+	 *
+	 * @param first	Puntero al inicio del arreglo.
+	 * @param count	La cantidad de elementos.
+	 * @param value	El valor por buscar. Su tamao debe ser 1, 2, 4 u 8 bytes.
+	 * @return la posicin del primer elemento igual a @a value, o @a count si no hay.
+	 */
+	template <typename ValueType>
+	__attribute__((target("avx2")))
+	std::size_t avx2_find(const ValueType* first, std::size_t count, ValueType value) noexcept
+	{
+		constexpr std::size_t lanes = 32 / sizeof(ValueType);
+		const __m256i needle = avx2_broadcast(value);
+		const __m256i* blocks = reinterpret_cast<const __m256i*>(first);
+
+		std::size_t index = 0;
+		for (; index + 4 * lanes <= count; index += 4 * lanes, blocks += 4)
+		{
+			const __m256i equal0 = avx2_equal_elements<sizeof(ValueType)>(_mm256_loadu_si256(blocks), needle);
+			const __m256i equal1 = avx2_equal_elements<sizeof(ValueType)>(_mm256_loadu_si256(blocks + 1), needle);
+			const __m256i equal2 = avx2_equal_elements<sizeof(ValueType)>(_mm256_loadu_si256(blocks + 2), needle);
+			const __m256i equal3 = avx2_equal_elements<sizeof(ValueType)>(_mm256_loadu_si256(blocks + 3), needle);
+			const __m256i any = _mm256_or_si256(_mm256_or_si256(equal0, equal1), _mm256_or_si256(equal2, equal3));
+			if (!_mm256_testz_si256(any, any))
+			{
+				const std::uint64_t low = std::uint64_t(unsigned(_mm256_movemask_epi8(equal0)))
+					| (std::uint64_t(unsigned(_mm256_movemask_epi8(equal1))) << 32);
+				if (low != 0)
+					return index + std::size_t(__builtin_ctzll(low)) / sizeof(ValueType);
+				const std::uint64_t high = std::uint64_t(unsigned(_mm256_movemask_epi8(equal2)))
+					| (std::uint64_t(unsigned(_mm256_movemask_epi8(equal3))) << 32);
+				return index + 2 * lanes + std::size_t(__builtin_ctzll(high)) / sizeof(ValueType);
+			}
+		}
+		for (; index + lanes <= count; index += lanes, ++blocks)
+		{
+			const unsigned int mask = unsigned(_mm256_movemask_epi8(
+				avx2_equal_elements<sizeof(ValueType)>(_mm256_loadu_si256(blocks), needle)));
+			if (mask != 0)
+				return index + std::size_t(__builtin_ctz(mask)) / sizeof(ValueType);
+		}
+		for (; index < count; ++index)
+			if (first[index] == value)
+				return index;
+		return count;
+	}
+
+	/**
+	 * Igual que sse2_count, pero con registros de 32 bytes.
+	 *
+	 * @param first	Puntero al inicio del arreglo.
+	 * @param count	La cantidad de elementos.
+	 * @param value	El valor por contar. Su tamao debe ser 1, 2, 4 u 8 bytes.
+	 * @return la cantidad de elementos iguales a @a value.
+	 */
+	template <typename ValueType>
+	__attribute__((target("avx2")))
+	std::size_t avx2_count(const ValueType* first, std::size_t count, ValueType value) noexcept
+	{
+		constexpr std::size_t lanes = 32 / sizeof(ValueType);
+		const __m256i needle = avx2_broadcast(value);
+		const __m256i zero = _mm256_setzero_si256();
+		const __m256i* blocks = reinterpret_cast<const __m256i*>(first);
+
+		__m256i totals = zero;
+		std::size_t index = 0;
+		while (index + lanes <= count)
+		{
+			std::size_t rounds = (count - index) / lanes;
+			if (rounds > 255)
+				rounds = 255;
+			index += rounds * lanes;
+
+			__m256i counters = zero;
+			for (; rounds > 0; --rounds, ++blocks)
+				counters = _mm256_sub_epi8(counters,
+					avx2_equal_elements<sizeof(ValueType)>(_mm256_loadu_si256(blocks), needle));
+			totals = _mm256_add_epi64(totals, _mm256_sad_epu8(counters, zero));
+		}
+
+		alignas(32) std::uint64_t lane_totals[4];
+		_mm256_store_si256(reinterpret_cast<__m256i*>(lane_totals), totals);
+		std::size_t result = std::size_t(lane_totals[0] + lane_totals[1] + lane_totals[2] + lane_totals[3])
+			/ sizeof(ValueType);
+		for (; index < count; ++index)
+			result += (first[index] == value);
+		return result;
+	}
+#endif
+
+	/**
+	 * Busca el primer elemento distinto entre dos arreglos contiguos de un tipo cuyos
+	 * valores son iguales si y solo si sus bytes lo son (enteros, punteros, enumeraciones).
+	 * Compara bloques de bytes con registros vectoriales y calcula el elemento a partir
+	 * del primer byte distinto.
+	 *
+	 * @param first1, first2	Punteros al inicio de los arreglos.
+	 * @param count				La cantidad de elementos por comparar.
+	 * @return la posicin del primer elemento distinto, o @a count si son iguales.
+	 */
+	template <typename ValueType>
+	std::size_t simd_mismatch(const ValueType* first1, const ValueType* first2, std::size_t count) noexcept
+	{
+#ifdef MY_SIMD_X86
+		const unsigned char* bytes1 = reinterpret_cast<const unsigned char*>(first1);
+		const unsigned char* bytes2 = reinterpret_cast<const unsigned char*>(first2);
+		const std::size_t bytes = count * sizeof(ValueType);
+
+		if (detect_simd_level() == simd_level::avx2)
+			return avx2_mismatch(bytes1, bytes2, bytes) / sizeof(ValueType);
+		return sse2_mismatch(bytes1, bytes2, bytes) / sizeof(ValueType);
+#else
+		std::size_t index = 0;
+		while (index < count && first1[index] == first2[index])
+			++index;
+		return index;
+#endif
+	}
+
+	/**
+	 * Busca @a value en un arreglo contiguo de enteros de 1, 2, 4 u 8 bytes, con AVX2 si
+	 * el procesador lo tiene o SSE2 si no.
+	 *
+	 * @param first	Puntero al inicio del arreglo.
+	 * @param count	La cantidad de elementos.
+	 * @param value	El valor por buscar.
+	 * @return la posicin del primer elemento igual a @a value, o @a count si no hay.
+	 */
+	template <typename ValueType>
+	std::size_t simd_find(const ValueType* first, std::size_t count, ValueType value) noexcept
+	{
+#ifdef MY_SIMD_X86
+		if (detect_simd_level() == simd_level::avx2)
+			return avx2_find(first, count, value);
+		return sse2_find(first, count, value);
+#else
+		std::size_t index = 0;
+		while (index < count && !(first[index] == value))
+			++index;
+		return index;
+#endif
+	}
+
+	/**
+	 * Cuenta los elementos iguales a @a value en un arreglo contiguo de enteros de 1, 2,
+	 * 4 u 8 bytes, con AVX2 si el procesador lo tiene o SSE2 si no.
+	 *
+	 * @param first	Puntero al inicio del arreglo.
+	 * @param count	La cantidad de elementos.
+	 * @param value	El valor por contar.
+	 * @return la cantidad de elementos iguales a @a value.
+	 */
+	template <typename ValueType>
+	std::size_t simd_count(const ValueType* first, std::size_t count, ValueType value) noexcept
+	{
+#ifdef MY_SIMD_X86
+		if (detect_simd_level() == simd_level::avx2)
+			return avx2_count(first, count, value);
+		return sse2_count(first, count, value);
+#else
+		std::size_t result = 0;
+		for (std::size_t index = 0; index < count; ++index)
+			result += (first[index] == value);
+		return result;
+#endif
+	}
+
+	/**
+	 * Asigna @a value a los elementos en [@a first, @a last) de un arreglo contiguo de un
+	 * tipo escalar de 1, 2, 4 u 8 bytes.
+	 *
+	 * Si todos los bytes de @a value son iguales (por ejemplo, cero), se usa memset. De lo
+	 * contrario, se escriben registros vectoriales que repiten el valor, con AVX2 si el
+	 * procesador lo tiene o SSE2 si no. Los bloques de al menos MY_NONTEMPORAL_THRESHOLD
+	 * bytes se escriben sin pasar por la cach, para no desalojar datos tiles con un
+	 * bloque que no cabe en ella.
+	 *
+	 * @param first, last	Punteros a las posiciones inicial y final de la secuencia.
+	 * @param value			El valor por asignar.
+	 */
+	template <typename ValueType>
+	void simd_fill(ValueType* first, ValueType* last, ValueType value) noexcept
+	{
+		static_assert(sizeof(ValueType) == 1 || sizeof(ValueType) == 2
+			|| sizeof(ValueType) == 4 || sizeof(ValueType) == 8,
+			"mySTL::simd_fill: el tamao del tipo debe ser 1, 2, 4 u 8 bytes");
+
+		const std::size_t bytes = std::size_t(last - first) * sizeof(ValueType);
+		if (bytes == 0)
+			return;
+
+		// Revisar si todos los bytes del valor son iguales.
+		unsigned char value_bytes[sizeof(ValueType)];
+		std::memcpy(value_bytes, &value, sizeof(ValueType));
+		bool uniform = true;
+		for (std::size_t index = 1; index < sizeof(ValueType); ++index)
+			uniform = uniform && (value_bytes[index] == value_bytes[0]);
+
+		if (uniform)
+		{
+			std::memset(first, value_bytes[0], bytes);
+			return;
+		}
+
+#ifdef MY_SIMD_X86
+		// Con pocos bytes no vale la pena preparar los registros.
+		if (bytes >= 64)
+		{
+			const bool nontemporal = (bytes >= MY_NONTEMPORAL_THRESHOLD);
+			if (detect_simd_level() == simd_level::avx2)
+				avx2_fill(first, last, value, nontemporal);
+			else
+				sse2_fill(first, last, value, nontemporal);
+			return;
+		}
+#endif
+		scalar_fill(first, last, value);
+	}
+}
+
+#endif /* MY_SIMD_H */
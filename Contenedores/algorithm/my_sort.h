@@ -0,0 +1,1133 @@
+#ifndef MY_SORT_H
+#define MY_SORT_H
+
+#include "my_algorithm.h"
+#include "my_merge.h"
+#include "../vector/my_vector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace mySTL
+{
+	// Este encabezado contiene los algoritmos de ordenamiento y de seleccin. sort est
+	// basado en pattern-defeating quicksort (pdqsort) de Orson Peters: un quicksort con
+	// mediana de tres (o de nueve en rangos grandes), ordenamiento por insercin en rangos
+	// pequeos, deteccin de rangos ya ordenados y de elementos repetidos, y heapsort como
+	// respaldo cuando las particiones salen desbalanceadas demasiadas veces. nth_element
+	// usa las mismas particiones, pero solo sigue la parte que contiene la posicin buscada.
+
+	// Constantes de sort.
+	enum : std::ptrdiff_t
+	{
+		sort_insertion_threshold = 24,	// Tamao mximo de un rango que se ordena por insercin.
+		sort_ninther_threshold = 128,	// Tamao a partir del cual el pivote es la mediana de nueve.
+		sort_partial_insertion_limit = 8,	// Movimientos permitidos al revisar si un rango ya est ordenado.
+		sort_block_size = 64,			// Elementos por bloque en la particin sin ramas.
+		stable_sort_insertion_threshold = 32,	// Tamao mximo de un rango que stable_sort ordena por insercin.
+		sort_partial_heap_ratio = 512	// partial_sort usa un montculo si k es a lo sumo n / 512.
+	};
+
+	// Funciones de montculo.
+
+	/**
+	 * Baja el valor @a value desde el hueco en @a hole hasta su lugar en el montculo
+	 * binario [@a first, @a first + @a count).
+	 *
+	 * @param first		Iterador al inicio del montculo.
+	 * @param hole		Posicin del hueco.
+	 * @param count		La cantidad de elementos del montculo.
+	 * @param value		El valor por colocar.
+	 * @param compare	Criterio de comparacin. La raz es el mayor elemento.
+	 */
+	template <typename RandomAccessIterator, typename Distance, typename ValueType, typename Compare>
+	void heap_sift_down(RandomAccessIterator first, Distance hole, Distance count, ValueType value,
+		Compare& compare)
+	{
+		for (;;)
+		{
+			Distance child = 2 * hole + 1;
+			if (child >= count)
+				break;
+			// Elegir el hijo mayor.
+			if (child + 1 < count && compare(first[child], first[child + 1]))
+				++child;
+			if (!compare(value, first[child]))
+				break;
+			first[hole] = std::move(first[child]);
+			hole = child;
+		}
+		first[hole] = std::move(value);
+	}
+
+	/**
+	 * Reorganiza los elementos en el rango [@a first, @a last) como un montculo binario
+	 * cuya raz es el mayor elemento segn @a compare.
+	 *
+	 * @param first		Iterador a la posicin inicial de la secuencia.
+	 * @param last		Iterador a la posicin final de la secuencia.
+	 * @param compare	Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void make_heap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		const difference_type count = last - first;
+		for (difference_type parent = count / 2; parent-- > 0; )
+			heap_sift_down(first, parent, count, std::move(first[parent]), compare);
+	}
+
+	/**
+	 * Mueve el mayor elemento del montculo [@a first, @a last) a la ltima posicin y
+	 * reorganiza el resto [@a first, @a last - 1) como un montculo.
+	 *
+	 * @param first		Iterador a la posicin inicial del montculo.
+	 * @param last		Iterador a la posicin final del montculo.
+	 * @param compare	Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void pop_heap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		const difference_type count = last - first;
+		if (count < 2)
+			return;
+
+		auto value = std::move(first[count - 1]);
+		first[count - 1] = std::move(*first);
+		heap_sift_down(first, difference_type(0), count - 1, std::move(value), compare);
+	}
+
+	/**
+	 * Agrega el elemento en @a last - 1 al montculo [@a first, @a last - 1).
+	 *
+	 * @param first		Iterador a la posicin inicial del montculo.
+	 * @param last		Iterador a la posicin siguiente al elemento por agregar.
+	 * @param compare	Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void push_heap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		difference_type hole = (last - first) - 1;
+		if (hole <= 0)
+			return;
+
+		auto value = std::move(first[hole]);
+		while (hole > 0)
+		{
+			const difference_type parent = (hole - 1) / 2;
+			if (!compare(first[parent], value))
+				break;
+			first[hole] = std::move(first[parent]);
+			hole = parent;
+		}
+		first[hole] = std::move(value);
+	}
+
+	/**
+	 * Ordena de forma ascendente el montculo [@a first, @a last).
+	 *
+	 * @param first		Iterador a la posicin inicial del montculo.
+	 * @param last		Iterador a la posicin final del montculo.
+	 * @param compare	Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void sort_heap(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	{
+		for (; last - first > 1; --last)
+			mySTL::pop_heap(first, last, compare);
+	}
+
+	// Funciones auxiliares de sort.
+
+	/**
+	 * Ordena por insercin el rango [@a first, @a last).
+	 *
+	 * @param first, last	Iteradores a las posiciones inicial y final del rango.
+	 * @param compare		Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
+	{
+		if (first == last)
+			return;
+
+		for (RandomAccessIterator current = first + 1; current != last; ++current)
+		{
+			RandomAccessIterator sift = current;
+			RandomAccessIterator sift_1 = current - 1;
+
+			// Solo mover el elemento si est fuera de lugar.
+			if (compare(*sift, *sift_1))
+			{
+				auto value = std::move(*sift);
+				do
+				{
+					*sift-- = std::move(*sift_1);
+				} while (sift != first && compare(value, *--sift_1));
+				*sift = std::move(value);
+			}
+		}
+	}
+
+	/**
+	 * Ordena por insercin el rango [@a first, @a last), suponiendo que el elemento antes
+	 * de @a first no es mayor que ninguno del rango. As no hace falta revisar el inicio
+	 * del rango en cada paso.
+	 *
+	 * @param first, last	Iteradores a las posiciones inicial y final del rango.
+	 * @param compare		Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void unguarded_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
+	{
+		if (first == last)
+			return;
+
+		for (RandomAccessIterator current = first + 1; current != last; ++current)
+		{
+			RandomAccessIterator sift = current;
+			RandomAccessIterator sift_1 = current - 1;
+
+			if (compare(*sift, *sift_1))
+			{
+				auto value = std::move(*sift);
+				do
+				{
+					*sift-- = std::move(*sift_1);
+				} while (compare(value, *--sift_1));
+				*sift = std::move(value);
+			}
+		}
+	}
+
+	/**
+	 * Intenta ordenar por insercin el rango [@a first, @a last), pero se detiene si tiene
+	 * que mover ms de sort_partial_insertion_limit elementos.
+	 *
+	 * @param first, last	Iteradores a las posiciones inicial y final del rango.
+	 * @param compare		Criterio de comparacin.
+	 * @return TRUE si el rango qued ordenado; FALSE si se detuvo antes.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	bool partial_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
+	{
+		if (first == last)
+			return true;
+
+		std::ptrdiff_t moved = 0;
+		for (RandomAccessIterator current = first + 1; current != last; ++current)
+		{
+			if (moved > sort_partial_insertion_limit)
+				return false;
+
+			RandomAccessIterator sift = current;
+			RandomAccessIterator sift_1 = current - 1;
+
+			if (compare(*sift, *sift_1))
+			{
+				auto value = std::move(*sift);
+				do
+				{
+					*sift-- = std::move(*sift_1);
+				} while (sift != first && compare(value, *--sift_1));
+				*sift = std::move(value);
+				moved += current - sift;
+			}
+		}
+		return true;
+	}
+
+	/// Ordena los elementos en @a first y @a second.
+	template <typename RandomAccessIterator, typename Compare>
+	inline void sort2(RandomAccessIterator first, RandomAccessIterator second, Compare& compare)
+	{
+		if (compare(*second, *first))
+			std::iter_swap(first, second);
+	}
+
+	/// Ordena los elementos en @a first, @a second y @a third.
+	template <typename RandomAccessIterator, typename Compare>
+	inline void sort3(RandomAccessIterator first, RandomAccessIterator second, RandomAccessIterator third,
+		Compare& compare)
+	{
+		sort2(first, second, compare);
+		sort2(second, third, compare);
+		sort2(first, second, compare);
+	}
+
+	/**
+	 * Particiona [@a first, @a last) alrededor del pivote *@a first: a la izquierda quedan
+	 * los elementos menores que el pivote y a la derecha los dems. Necesita que exista un
+	 * elemento no menor que el pivote en el rango (la mediana lo garantiza).
+	 *
+	 * @param first, last	Iteradores a las posiciones inicial y final del rango.
+	 * @param compare		Criterio de comparacin.
+	 * @return la posicin final del pivote, y TRUE si el rango ya estaba particionado.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	std::pair<RandomAccessIterator, bool> partition_right(RandomAccessIterator first, RandomAccessIterator last,
+		Compare& compare)
+	{
+		auto pivot = std::move(*first);
+		RandomAccessIterator left = first;
+		RandomAccessIterator right = last;
+
+		// Buscar el primer elemento no menor que el pivote. La mediana de tres garantiza
+		// que existe, as que no hace falta revisar el final.
+		while (compare(*++left, pivot));
+
+		// Buscar el ltimo elemento menor que el pivote. Si no se movi left, puede que no
+		// exista, y hay que revisar el inicio.
+		if (left - 1 == first)
+			while (left < right && !compare(*--right, pivot));
+		else
+			while (!compare(*--right, pivot));
+
+		// Si los iteradores se cruzaron, no hace falta intercambiar nada.
+		const bool already_partitioned = (left >= right);
+
+		while (left < right)
+		{
+			std::iter_swap(left, right);
+			while (compare(*++left, pivot));
+			while (!compare(*--right, pivot));
+		}
+
+		// Colocar el pivote en su lugar.
+		RandomAccessIterator pivot_position = left - 1;
+		*first = std::move(*pivot_position);
+		*pivot_position = std::move(pivot);
+		return std::pair<RandomAccessIterator, bool>(pivot_position, already_partitioned);
+	}
+
+	/**
+	 * Intercambia los elementos de [@a left_base, ...) indicados por @a left_offsets con los
+	 * de (..., @a right_base] indicados por @a right_offsets. Si los bloques tienen el mismo
+	 * tamao se hacen intercambios; de lo contrario, un ciclo de movimientos.
+	 */
+	template <typename RandomAccessIterator>
+	inline void swap_offsets(RandomAccessIterator left_base, RandomAccessIterator right_base,
+		const unsigned char* left_offsets, const unsigned char* right_offsets, std::size_t count, bool use_swaps)
+	{
+		if (use_swaps)
+		{
+			// Con intercambios, una secuencia descendente queda bien particionada.
+			for (std::size_t index = 0; index < count; ++index)
+				std::iter_swap(left_base + left_offsets[index], right_base - right_offsets[index]);
+		}
+		else if (count > 0)
+		{
+			RandomAccessIterator left = left_base + left_offsets[0];
+			RandomAccessIterator right = right_base - right_offsets[0];
+			auto value = std::move(*left);
+			*left = std::move(*right);
+			for (std::size_t index = 1; index < count; ++index)
+			{
+				left = left_base + left_offsets[index];
+				*right = std::move(*left);
+				right = right_base - right_offsets[index];
+				*left = std::move(*right);
+			}
+			*right = std::move(value);
+		}
+	}
+
+	/**
+	 * Igual que partition_right, pero sin ramas dependientes de las comparaciones: cada
+	 * bloque de sort_block_size elementos se recorre guardando las posiciones de los
+	 * elementos que estn del lado equivocado, sumando el resultado de la comparacin en
+	 * lugar de saltar. Despus se intercambian los elementos guardados. Con tipos
+	 * aritmticos y comparaciones baratas evita las predicciones fallidas de saltos.
+	 *
+	 * @param first, last	Punteros a las posiciones inicial y final del rango.
+	 * @param compare		Criterio de comparacin.
+	 * @return la posicin final del pivote, y TRUE si el rango ya estaba particionado.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	std::pair<RandomAccessIterator, bool> partition_right_branchless(RandomAccessIterator first,
+		RandomAccessIterator last, Compare& compare)
+	{
+		auto pivot = std::move(*first);
+		RandomAccessIterator left = first;
+		RandomAccessIterator right = last;
+
+		while (compare(*++left, pivot));
+		if (left - 1 == first)
+			while (left < right && !compare(*--right, pivot));
+		else
+			while (!compare(*--right, pivot));
+
+		const bool already_partitioned = (left >= right);
+		if (!already_partitioned)
+		{
+			std::iter_swap(left, right);
+			++left;
+
+			alignas(64) unsigned char left_offsets[sort_block_size];
+			alignas(64) unsigned char right_offsets[sort_block_size];
+			RandomAccessIterator left_base = left;
+			RandomAccessIterator right_base = right;
+			std::size_t left_count = 0;
+			std::size_t right_count = 0;
+			std::size_t left_start = 0;
+			std::size_t right_start = 0;
+
+			while (left < right)
+			{
+				// Decidir cuntos elementos se revisan de cada lado: solo se rellena un
+				// bloque cuando se vaci.
+				const std::size_t unknown = std::size_t(right - left);
+				const std::size_t left_split = (left_count == 0) ? ( (right_count == 0) ? unknown / 2 : unknown ) : 0;
+				const std::size_t right_split = (right_count == 0) ? (unknown - left_split) : 0;
+
+				if (left_split >= std::size_t(sort_block_size))
+				{
+					for (std::size_t index = 0; index < std::size_t(sort_block_size); )
+					{
+						left_offsets[left_count] = (unsigned char)(index++);
+						left_count += !compare(*left, pivot);
+						++left;
+						left_offsets[left_count] = (unsigned char)(index++);
+						left_count += !compare(*left, pivot);
+						++left;
+						left_offsets[left_count] = (unsigned char)(index++);
+						left_count += !compare(*left, pivot);
+						++left;
+						left_offsets[left_count] = (unsigned char)(index++);
+						left_count += !compare(*left, pivot);
+						++left;
+					}
+				}
+				else
+				{
+					for (std::size_t index = 0; index < left_split; )
+					{
+						left_offsets[left_count] = (unsigned char)(index++);
+						left_count += !compare(*left, pivot);
+						++left;
+					}
+				}
+
+				if (right_split >= std::size_t(sort_block_size))
+				{
+					for (std::size_t index = 0; index < std::size_t(sort_block_size); )
+					{
+						right_offsets[right_count] = (unsigned char)(++index);
+						right_count += compare(*--right, pivot);
+						right_offsets[right_count] = (unsigned char)(++index);
+						right_count += compare(*--right, pivot);
+						right_offsets[right_count] = (unsigned char)(++index);
+						right_count += compare(*--right, pivot);
+						right_offsets[right_count] = (unsigned char)(++index);
+						right_count += compare(*--right, pivot);
+					}
+				}
+				else
+				{
+					for (std::size_t index = 0; index < right_split; )
+					{
+						right_offsets[right_count] = (unsigned char)(++index);
+						right_count += compare(*--right, pivot);
+					}
+				}
+
+				// Intercambiar tantos elementos como haya en el bloque ms pequeo.
+				const std::size_t count = (left_count < right_count) ? left_count : right_count;
+				swap_offsets(left_base, right_base, left_offsets + left_start, right_offsets + right_start,
+					count, left_count == right_count);
+				left_count -= count;
+				right_count -= count;
+				left_start += count;
+				right_start += count;
+				if (left_count == 0)
+				{
+					left_start = 0;
+					left_base = left;
+				}
+				if (right_count == 0)
+				{
+					right_start = 0;
+					right_base = right;
+				}
+			}
+
+			// Queda a lo sumo un bloque con elementos del lado equivocado: moverlos al
+			// borde de la particin.
+			if (left_count > 0)
+			{
+				const unsigned char* offsets = left_offsets + left_start;
+				while (left_count-- > 0)
+					std::iter_swap(left_base + offsets[left_count], --right);
+				left = right;
+			}
+			if (right_count > 0)
+			{
+				const unsigned char* offsets = right_offsets + right_start;
+				while (right_count-- > 0)
+				{
+					std::iter_swap(right_base - offsets[right_count], left);
+					++left;
+				}
+			}
+		}
+
+		RandomAccessIterator pivot_position = left - 1;
+		*first = std::move(*pivot_position);
+		*pivot_position = std::move(pivot);
+		return std::pair<RandomAccessIterator, bool>(pivot_position, already_partitioned);
+	}
+
+	/**
+	 * Particiona [@a first, @a last) alrededor del pivote *@a first, dejando a la izquierda
+	 * los elementos equivalentes al pivote y a la derecha los mayores. Se usa cuando el
+	 * pivote es igual al elemento anterior al rango, es decir, cuando hay muchos repetidos:
+	 * los equivalentes al pivote quedan en su lugar final y no se vuelven a ordenar.
+	 *
+	 * @param first, last	Iteradores a las posiciones inicial y final del rango.
+	 * @param compare		Criterio de comparacin.
+	 * @return la posicin final del pivote.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	RandomAccessIterator partition_left(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
+	{
+		auto pivot = std::move(*first);
+		RandomAccessIterator left = first;
+		RandomAccessIterator right = last;
+
+		while (compare(pivot, *--right));
+		if (right + 1 == last)
+			while (left < right && !compare(pivot, *++left));
+		else
+			while (!compare(pivot, *++left));
+
+		while (left < right)
+		{
+			std::iter_swap(left, right);
+			while (compare(pivot, *--right));
+			while (!compare(pivot, *++left));
+		}
+
+		RandomAccessIterator pivot_position = right;
+		*first = std::move(*pivot_position);
+		*pivot_position = std::move(pivot);
+		return pivot_position;
+	}
+
+	/**
+	 * Elige el pivote de [@a first, @a last) con la mediana de tres, o la mediana de tres
+	 * medianas (de nueve) en rangos de ms de sort_ninther_threshold elementos, y lo
+	 * coloca en @a first. El rango debe tener al menos 3 elementos.
+	 *
+	 * @param first, last	Iteradores a las posiciones inicial y final del rango.
+	 * @param compare		Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void choose_pivot(RandomAccessIterator first, RandomAccessIterator last, Compare& compare)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		const difference_type size = last - first;
+		const difference_type half = size / 2;
+		if (size > sort_ninther_threshold)
+		{
+			sort3(first, first + half, last - 1, compare);
+			sort3(first + 1, first + (half - 1), last - 2, compare);
+			sort3(first + 2, first + (half + 1), last - 3, compare);
+			sort3(first + (half - 1), first + half, first + (half + 1), compare);
+			std::iter_swap(first, first + half);
+		}
+		else
+			sort3(first + half, first, last - 1, compare);
+	}
+
+	/**
+	 * Despus de una particin muy desbalanceada de [@a first, @a last) alrededor de
+	 * @a pivot_position, intercambia algunos elementos de cada parte para romper el
+	 * patrn de la entrada que la produjo, de manera que el siguiente pivote sea otro.
+	 *
+	 * @param first, last		Iteradores a las posiciones inicial y final del rango.
+	 * @param pivot_position	La posicin final del pivote.
+	 */
+	template <typename RandomAccessIterator>
+	void break_patterns(RandomAccessIterator first, RandomAccessIterator pivot_position, RandomAccessIterator last)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		const difference_type left_size = pivot_position - first;
+		const difference_type right_size = last - (pivot_position + 1);
+
+		if (left_size >= sort_insertion_threshold)
+		{
+			std::iter_swap(first, first + left_size / 4);
+			std::iter_swap(pivot_position - 1, pivot_position - left_size / 4);
+			if (left_size > sort_ninther_threshold)
+			{
+				std::iter_swap(first + 1, first + (left_size / 4 + 1));
+				std::iter_swap(first + 2, first + (left_size / 4 + 2));
+				std::iter_swap(pivot_position - 2, pivot_position - (left_size / 4 + 1));
+				std::iter_swap(pivot_position - 3, pivot_position - (left_size / 4 + 2));
+			}
+		}
+		if (right_size >= sort_insertion_threshold)
+		{
+			std::iter_swap(pivot_position + 1, pivot_position + (1 + right_size / 4));
+			std::iter_swap(last - 1, last - right_size / 4);
+			if (right_size > sort_ninther_threshold)
+			{
+				std::iter_swap(pivot_position + 2, pivot_position + (2 + right_size / 4));
+				std::iter_swap(pivot_position + 3, pivot_position + (3 + right_size / 4));
+				std::iter_swap(last - 2, last - (1 + right_size / 4));
+				std::iter_swap(last - 3, last - (2 + right_size / 4));
+			}
+		}
+	}
+
+	/**
+	 * Ciclo principal de sort: particiona [@a first, @a last), ordena recursivamente la
+	 * parte izquierda y sigue con la derecha en el mismo ciclo.
+	 *
+	 * @param first, last	Iteradores a las posiciones inicial y final del rango.
+	 * @param compare		Criterio de comparacin.
+	 * @param bad_allowed	Particiones desbalanceadas permitidas antes de usar heapsort.
+	 * @param leftmost		Indica si el rango es el primero del arreglo, es decir, si no hay
+	 * un elemento menor antes de @a first.
+	 */
+	template <bool Branchless, typename RandomAccessIterator, typename Compare>
+	void sort_loop(RandomAccessIterator first, RandomAccessIterator last, Compare& compare, int bad_allowed,
+		bool leftmost)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+		for (;;)
+		{
+			const difference_type size = last - first;
+
+			// Los rangos pequeos se ordenan por insercin.
+			if (size < sort_insertion_threshold)
+			{
+				if (leftmost)
+					insertion_sort(first, last, compare);
+				else
+					unguarded_insertion_sort(first, last, compare);
+				return;
+			}
+
+			choose_pivot(first, last, compare);
+
+			// Si el pivote es igual al elemento anterior al rango (que es menor o igual que
+			// todos los del rango), hay muchos repetidos: separar los iguales al pivote.
+			if (!leftmost && !compare(*(first - 1), *first))
+			{
+				first = partition_left(first, last, compare) + 1;
+				continue;
+			}
+
+			std::pair<RandomAccessIterator, bool> partition_result;
+			if constexpr (Branchless)
+				partition_result = partition_right_branchless(first, last, compare);
+			else
+				partition_result = partition_right(first, last, compare);
+			const RandomAccessIterator pivot_position = partition_result.first;
+			const bool already_partitioned = partition_result.second;
+
+			const difference_type left_size = pivot_position - first;
+			const difference_type right_size = last - (pivot_position + 1);
+			const bool highly_unbalanced = (left_size < size / 8) || (right_size < size / 8);
+
+			if (highly_unbalanced)
+			{
+				// Demasiadas particiones malas: el peor caso de quicksort est cerca.
+				if (--bad_allowed == 0)
+				{
+					mySTL::make_heap(first, last, compare);
+					mySTL::sort_heap(first, last, compare);
+					return;
+				}
+
+				// Romper el patrn que produjo la particin mala.
+				break_patterns(first, pivot_position, last);
+			}
+			else if (already_partitioned && partial_insertion_sort(first, pivot_position, compare)
+				&& partial_insertion_sort(pivot_position + 1, last, compare))
+			{
+				// La particin no movi nada y ambas partes estaban casi ordenadas.
+				return;
+			}
+
+			// Ordenar la parte izquierda recursivamente y seguir con la derecha.
+			sort_loop<Branchless>(first, pivot_position, compare, bad_allowed, leftmost);
+			first = pivot_position + 1;
+			leftmost = false;
+		}
+	}
+
+	/**
+	 * Ordena los elementos en el rango [@a first, @a last) segn @a compare. No es estable.
+	 * Toma O(n log n) en el peor caso y O(n) con rangos ordenados, invertidos o con pocos
+	 * valores distintos.
+	 *
+	 * @param first		Iterador de acceso aleatorio a la posicin inicial de la secuencia.
+	 * @param last		Iterador de acceso aleatorio a la posicin final de la secuencia.
+	 * @param compare	Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+		if (last - first < 2)
+			return;
+
+		// Particiones malas permitidas: el logaritmo en base 2 del tamao.
+		int bad_allowed = 0;
+		for (auto size = last - first; size > 1; size >>= 1)
+			++bad_allowed;
+
+		// La particin sin ramas calcula posiciones con aritmtica de iteradores, que solo
+		// es barata con punteros.
+		constexpr bool branchless = std::is_pointer_v<RandomAccessIterator>
+			&& std::is_arithmetic_v<value_type> && is_default_compare_v<Compare, value_type>;
+		sort_loop<branchless>(first, last, compare, bad_allowed, true);
+	}
+
+	/**
+	 * Ordena de forma ascendente los elementos en el rango [@a first, @a last).
+	 *
+	 * @param first		Iterador de acceso aleatorio a la posicin inicial de la secuencia.
+	 * @param last		Iterador de acceso aleatorio a la posicin final de la secuencia.
+	 */
+	template <typename RandomAccessIterator>
+	void sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		mySTL::sort(first, last, std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	/**
+	 * Ordena de forma estable [@a first, @a last) con mergesort: ordena cada mitad
+	 * recursivamente y las mezcla con merge_adaptive. Los rangos pequeos se ordenan por
+	 * insercin, y si las mitades ya estn en orden no se mezclan, as que un rango
+	 * ordenado toma O(n).
+	 *
+	 * @param first, last	Iteradores a las posiciones inicial y final del rango.
+	 * @param buffer		Memoria sin inicializar para las mezclas.
+	 * @param buffer_size	La cantidad de elementos que caben en @a buffer.
+	 * @param compare		Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename ValueType, typename Compare>
+	void stable_sort_adaptive(RandomAccessIterator first, RandomAccessIterator last, ValueType* buffer,
+		std::size_t buffer_size, Compare& compare)
+	{
+		const std::size_t count = std::size_t(last - first);
+		if (count <= std::size_t(stable_sort_insertion_threshold))
+		{
+			insertion_sort(first, last, compare);
+			return;
+		}
+
+		const RandomAccessIterator middle = first + count / 2;
+		stable_sort_adaptive(first, middle, buffer, buffer_size, compare);
+		stable_sort_adaptive(middle, last, buffer, buffer_size, compare);
+
+		if (compare(*middle, *(middle - 1)))
+			merge_adaptive(first, middle, last, count / 2, count - count / 2, buffer, buffer_size, compare);
+	}
+
+	/**
+	 * Ordena los elementos en el rango [@a first, @a last) segn @a compare, conservando el
+	 * orden relativo de los elementos equivalentes.
+	 *
+	 * Intenta reservar memoria para la mitad del rango, con la que toma O(n log n). Si no
+	 * se puede, usa la memoria que consiga; sin memoria adicional, las mezclas se hacen con
+	 * rotaciones y el ordenamiento toma O(n log n).
+	 *
+	 * @param first		Iterador de acceso aleatorio a la posicin inicial de la secuencia.
+	 * @param last		Iterador de acceso aleatorio a la posicin final de la secuencia.
+	 * @param compare	Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void stable_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+		const std::size_t count = std::size_t(last - first);
+		if (count < 2)
+			return;
+
+		temporary_buffer<value_type> buffer((count + 1) / 2);
+		stable_sort_adaptive(first, last, buffer.data(), buffer.capacity(), compare);
+	}
+
+	/**
+	 * Ordena de forma ascendente y estable los elementos en el rango [@a first, @a last).
+	 *
+	 * @param first		Iterador de acceso aleatorio a la posicin inicial de la secuencia.
+	 * @param last		Iterador de acceso aleatorio a la posicin final de la secuencia.
+	 */
+	template <typename RandomAccessIterator>
+	void stable_sort(RandomAccessIterator first, RandomAccessIterator last)
+	{
+		mySTL::stable_sort(first, last,
+			std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	// Algoritmos de seleccin.
+
+	/**
+	 * Reorganiza [@a first, @a last) de manera que [@a first, @a middle) contenga los
+	 * @a middle - @a first menores elementos, como un montculo cuya raz es el mayor de
+	 * ellos. Recorre el resto del rango una vez y solo toca el montculo cuando encuentra
+	 * un elemento menor que la raz.
+	 *
+	 * @param first, middle, last	Iteradores a los lmites del rango.
+	 * @param compare				Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void heap_select(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+		Compare& compare)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		mySTL::make_heap(first, middle, compare);
+
+		const difference_type heap_size = middle - first;
+		for (RandomAccessIterator current = middle; current < last; ++current)
+		{
+			if (compare(*current, *first))
+			{
+				auto value = std::move(*current);
+				*current = std::move(*first);
+				heap_sift_down(first, difference_type(0), heap_size, std::move(value), compare);
+			}
+		}
+	}
+
+	/**
+	 * Ciclo principal de nth_element (introselect): particiona [@a first, @a last) como
+	 * sort_loop y sigue solo con la parte que contiene @a nth. Si las particiones salen
+	 * desbalanceadas demasiadas veces, termina con heap_select.
+	 *
+	 * @param first, last	Iteradores a las posiciones inicial y final del rango.
+	 * @param nth			Iterador a la posicin buscada.
+	 * @param compare		Criterio de comparacin.
+	 * @param bad_allowed	Particiones desbalanceadas permitidas antes de usar heap_select.
+	 */
+	template <bool Branchless, typename RandomAccessIterator, typename Compare>
+	void select_loop(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last,
+		Compare& compare, int bad_allowed)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+		const RandomAccessIterator begin = first;
+
+		for (;;)
+		{
+			const difference_type size = last - first;
+			if (size < sort_insertion_threshold)
+			{
+				insertion_sort(first, last, compare);
+				return;
+			}
+
+			choose_pivot(first, last, compare);
+
+			// El elemento anterior al rango es menor o igual que todos los del rango. Si es
+			// igual al pivote, separar los iguales: ya estn en su posicin final.
+			if (first != begin && !compare(*(first - 1), *first))
+			{
+				const RandomAccessIterator pivot_position = partition_left(first, last, compare);
+				if (nth <= pivot_position)
+					return;
+				first = pivot_position + 1;
+				continue;
+			}
+
+			std::pair<RandomAccessIterator, bool> partition_result;
+			if constexpr (Branchless)
+				partition_result = partition_right_branchless(first, last, compare);
+			else
+				partition_result = partition_right(first, last, compare);
+			const RandomAccessIterator pivot_position = partition_result.first;
+			if (pivot_position == nth)
+				return;
+
+			const difference_type left_size = pivot_position - first;
+			const difference_type right_size = last - (pivot_position + 1);
+			if (left_size < size / 8 || right_size < size / 8)
+			{
+				if (--bad_allowed == 0)
+				{
+					// Los nth - first + 1 menores quedan en un montculo cuya raz es el
+					// elemento buscado.
+					heap_select(first, nth + 1, last, compare);
+					std::iter_swap(first, nth);
+					return;
+				}
+				break_patterns(first, pivot_position, last);
+			}
+
+			if (nth < pivot_position)
+				last = pivot_position;
+			else
+				first = pivot_position + 1;
+		}
+	}
+
+	/**
+	 * Reorganiza [@a first, @a last) de manera que en @a nth quede el elemento que estara
+	 * en esa posicin si el rango estuviera ordenado, ningn elemento antes de @a nth sea
+	 * mayor que l y ninguno despus sea menor. Toma O(n) en promedio y O(n log n) en el
+	 * peor caso.
+	 *
+	 * @param first		Iterador de acceso aleatorio a la posicin inicial de la secuencia.
+	 * @param nth		Iterador a la posicin buscada.
+	 * @param last		Iterador de acceso aleatorio a la posicin final de la secuencia.
+	 * @param compare	Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last,
+		Compare compare)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+		if (last - first < 2 || nth == last)
+			return;
+
+		int bad_allowed = 0;
+		for (auto size = last - first; size > 1; size >>= 1)
+			++bad_allowed;
+
+		constexpr bool branchless = std::is_pointer_v<RandomAccessIterator>
+			&& std::is_arithmetic_v<value_type> && is_default_compare_v<Compare, value_type>;
+		select_loop<branchless>(first, nth, last, compare, bad_allowed);
+	}
+
+	/**
+	 * Reorganiza [@a first, @a last) de manera que en @a nth quede el elemento que estara
+	 * en esa posicin si el rango estuviera ordenado de forma ascendente.
+	 *
+	 * @param first		Iterador de acceso aleatorio a la posicin inicial de la secuencia.
+	 * @param nth		Iterador a la posicin buscada.
+	 * @param last		Iterador de acceso aleatorio a la posicin final de la secuencia.
+	 */
+	template <typename RandomAccessIterator>
+	void nth_element(RandomAccessIterator first, RandomAccessIterator nth, RandomAccessIterator last)
+	{
+		mySTL::nth_element(first, nth, last,
+			std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	/**
+	 * Ordena los @a middle - @a first menores elementos de [@a first, @a last) en
+	 * [@a first, @a middle). El orden del resto queda sin especificar.
+	 *
+	 * Si se piden muy pocos elementos (a lo sumo 1/512 del rango), se usa heap_select, que
+	 * recorre el rango una vez y casi nunca toca el montculo; de lo contrario, nth_element
+	 * separa los menores en O(n) y despus se ordenan con sort. Con ms elementos, los
+	 * reemplazos en el montculo cuestan ms que las pasadas de nth_element.
+	 *
+	 * @param first		Iterador de acceso aleatorio a la posicin inicial de la secuencia.
+	 * @param middle	Iterador a la posicin final de la parte por ordenar.
+	 * @param last		Iterador de acceso aleatorio a la posicin final de la secuencia.
+	 * @param compare	Criterio de comparacin.
+	 */
+	template <typename RandomAccessIterator, typename Compare>
+	void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
+		Compare compare)
+	{
+		if (first == middle)
+			return;
+
+		if ((middle - first) * sort_partial_heap_ratio <= (last - first))
+		{
+			heap_select(first, middle, last, compare);
+			mySTL::sort_heap(first, middle, compare);
+		}
+		else
+		{
+			mySTL::nth_element(first, middle - 1, last, compare);
+			mySTL::sort(first, middle - 1, compare);
+		}
+	}
+
+	/**
+	 * Ordena de forma ascendente los @a middle - @a first menores elementos de
+	 * [@a first, @a last) en [@a first, @a middle).
+	 *
+	 * @param first		Iterador de acceso aleatorio a la posicin inicial de la secuencia.
+	 * @param middle	Iterador a la posicin final de la parte por ordenar.
+	 * @param last		Iterador de acceso aleatorio a la posicin final de la secuencia.
+	 */
+	template <typename RandomAccessIterator>
+	void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last)
+	{
+		mySTL::partial_sort(first, middle, last,
+			std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	/**
+	 * Copia los menores elementos de [@a first, @a last), ordenados, al rango
+	 * [@a result_first, @a result_last): tantos como quepan, o todos si son menos. La
+	 * entrada se lee una sola vez, as que puede ser un flujo.
+	 *
+	 * @param first, last					Iteradores a los lmites de la secuencia de entrada.
+	 * @param result_first, result_last		Iteradores de acceso aleatorio a los lmites del destino.
+	 * @param compare						Criterio de comparacin.
+	 * @return Iterador al final de los elementos copiados en el destino.
+	 */
+	template <typename InputIterator, typename RandomAccessIterator, typename Compare>
+	RandomAccessIterator partial_sort_copy(InputIterator first, InputIterator last,
+		RandomAccessIterator result_first, RandomAccessIterator result_last, Compare compare)
+	{
+		typedef typename std::iterator_traits<RandomAccessIterator>::value_type value_type;
+		typedef typename std::iterator_traits<RandomAccessIterator>::difference_type difference_type;
+
+		RandomAccessIterator result_end = result_first;
+		for (; first != last && result_end != result_last; ++first, ++result_end)
+			*result_end = *first;
+		if (result_end == result_first)
+			return result_first;
+
+		// El destino es un montculo con el mayor de los menores en la raz.
+		mySTL::make_heap(result_first, result_end, compare);
+		const difference_type heap_size = result_end - result_first;
+		for (; first != last; ++first)
+			if (compare(*first, *result_first))
+				heap_sift_down(result_first, difference_type(0), heap_size, value_type(*first), compare);
+
+		mySTL::sort_heap(result_first, result_end, compare);
+		return result_end;
+	}
+
+	/**
+	 * Copia los menores elementos de [@a first, @a last), ordenados de forma ascendente,
+	 * al rango [@a result_first, @a result_last).
+	 *
+	 * @param first, last					Iteradores a los lmites de la secuencia de entrada.
+	 * @param result_first, result_last		Iteradores de acceso aleatorio a los lmites del destino.
+	 * @return Iterador al final de los elementos copiados en el destino.
+	 */
+	template <typename InputIterator, typename RandomAccessIterator>
+	RandomAccessIterator partial_sort_copy(InputIterator first, InputIterator last,
+		RandomAccessIterator result_first, RandomAccessIterator result_last)
+	{
+		return mySTL::partial_sort_copy(first, last, result_first, result_last,
+			std::less<typename std::iterator_traits<RandomAccessIterator>::value_type>());
+	}
+
+	/**
+	 * @brief Conserva los k mayores elementos de una secuencia que llega de a uno, por
+	 * ejemplo para calcular el percentil 99.9 de una serie de latencias sin guardarla.
+	 *
+	 * Los elementos se guardan en un montculo de a lo sumo k elementos cuya raz es el
+	 * menor de ellos. Un elemento nuevo se compara solo con la raz, y solo si es mayor la
+	 * reemplaza y baja por el montculo: con una entrada aleatoria eso ocurre pocas veces,
+	 * as que cada push cuesta casi siempre una comparacin.
+	 *
+	 * @tparam ValueType	El tipo de los elementos.
+	 * @tparam Compare		Criterio de comparacin. Con std::less se conservan los mayores.
+	 */
+	template <typename ValueType, typename Compare = std::less<ValueType>>
+	class top_k
+	{
+	// Tipos miembro pblicos
+	public:
+		// Primer parmetro de plantilla.
+		typedef ValueType value_type;
+		// Tipo entero sin signo.
+		typedef std::size_t size_type;
+
+	// Atributos privados
+	private:
+		/// Compara al revs, para que la raz del montculo sea el menor elemento.
+		struct reverse_compare
+		{
+			Compare compare;
+			bool operator()(const ValueType& lhs, const ValueType& rhs) const { return compare(rhs, lhs); }
+		};
+
+		mySTL::vector<ValueType> heap;	// Los elementos conservados; heap[0] es el menor.
+		size_type limit;				// La cantidad mxima de elementos, k.
+		reverse_compare heap_compare;	// Criterio de comparacin del montculo.
+
+	// Mtodos pblicos
+	public:
+		/**
+		 * Construye el conjunto vaco.
+		 *
+		 * @param k			La cantidad de elementos por conservar.
+		 * @param compare	Criterio de comparacin.
+		 */
+		explicit top_k(size_type k, Compare compare = Compare())
+			: heap()
+			, limit(k)
+			, heap_compare{ compare }
+		{
+			this->heap.reserve(k);
+		}
+
+		/// Verifica si todava no se ha conservado ningn elemento.
+		inline bool empty() const { return this->heap.empty(); }
+
+		/// Retorna la cantidad de elementos conservados, a lo sumo k.
+		inline size_type size() const { return this->heap.size(); }
+
+		/// Retorna k, la cantidad mxima de elementos.
+		inline size_type capacity() const { return this->limit; }
+
+		/**
+		 * Retorna el menor de los elementos conservados: cuando ya hay k, es el k-simo
+		 * mayor de todos los recibidos. No debe estar vaco.
+		 */
+		inline const ValueType& threshold() const { return this->heap.front(); }
+
+		/**
+		 * Recibe un elemento y lo conserva si est entre los k mayores hasta el momento.
+		 *
+		 * @param value	El elemento.
+		 */
+		void push(const ValueType& value)
+		{
+			if (this->heap.size() < this->limit)
+			{
+				this->heap.push_back(value);
+				mySTL::push_heap(this->heap.begin(), this->heap.end(), this->heap_compare);
+			}
+			else if (this->limit > 0 && this->heap_compare.compare(this->heap.front(), value))
+			{
+				heap_sift_down(this->heap.begin(), std::ptrdiff_t(0), std::ptrdiff_t(this->heap.size()), value,
+					this->heap_compare);
+			}
+		}
+
+		/**
+		 * Recibe todos los elementos en el rango [@a first, @a last).
+		 *
+		 * @param first, last	Iteradores a los lmites de la secuencia.
+		 */
+		template <typename InputIterator>
+		void push(InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+				this->push(*first);
+		}
+
+		/// Retorna una copia de los elementos conservados, de mayor a menor.
+		mySTL::vector<ValueType> sorted() const
+		{
+			mySTL::vector<ValueType> result;
+			result.reserve(this->heap.size());
+			for (size_type index = 0; index < this->heap.size(); ++index)
+				result.push_back(this->heap[index]);
+			mySTL::sort_heap(result.begin(), result.end(), this->heap_compare);
+			return result;
+		}
+
+		/// Elimina todos los elementos conservados, sin liberar la memoria del montculo.
+		void clear()
+		{
+			while (!this->heap.empty())
+				this->heap.pop_back();
+		}
+	};
+}
+
+#endif /* MY_SORT_H */
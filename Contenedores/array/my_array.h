@@ -172,9 +172,9 @@ namespace mySTL
          */
         inline void fill(const value_type& value)
         {
-            // Para cada elemento de tipo value_type en el contenedor de elementos
-            for ( value_type& element : elements )
-                element = value; // Asignarle el valor recibido como parmetro.
+            // Asignar el valor recibido a todos los elementos. Para tipos escalares,
+            // mySTL::fill usa memset o registros vectoriales.
+            mySTL::fill(elements, elements + Size, value);
         }
 
         /**
@@ -0,0 +1,64 @@
+#include "BenchBinarySearch.h"
+
+#include <random>
+
+namespace
+{
+    /// Retorna los nanosegundos por bsqueda de aplicar @a search a cada valor de @a queries.
+    template <typename Search>
+    double time_search(const mySTL::vector<std::uint32_t>& queries, Search search)
+    {
+        std::uint64_t checksum = 0;
+        bench_timer timer;
+        for (std::size_t index = 0; index < queries.size(); ++index)
+            checksum += search(queries[index]);
+        const double seconds = timer.seconds();
+        do_not_optimize(checksum);
+        return seconds * 1e9 / double(queries.size());
+    }
+}
+
+int benchBinarySearch()
+{
+    const std::size_t query_count = std::size_t(1) << 20;
+    std::mt19937 generator(17);
+
+    std::printf("lower_bound sobre enteros de 32 bits (ns por busqueda, 2^20 busquedas al azar):\n");
+    std::printf("   elementos     tabla   std::lower_bound   mySTL (con saltos)   mySTL::lower_bound   eytzinger_array\n");
+    for (std::size_t count = std::size_t(1) << 10; count <= (std::size_t(1) << 26); count <<= 2)
+    {
+        // Valores pares, para que la mitad de las bsquedas no encuentre el valor.
+        mySTL::vector<std::uint32_t> table(count);
+        for (std::size_t index = 0; index < count; ++index)
+            table[index] = std::uint32_t(generator()) & ~1u;
+        mySTL::sort(table.data(), table.data() + count);
+        const mySTL::eytzinger_array<std::uint32_t> eytzinger(table);
+
+        mySTL::vector<std::uint32_t> queries(query_count);
+        for (std::size_t index = 0; index < query_count; ++index)
+            queries[index] = std::uint32_t(generator());
+
+        const std::uint32_t* first = table.data();
+        const std::uint32_t* last = first + count;
+        const double std_time = time_search(queries, [first, last](std::uint32_t value)
+            { return std::size_t(std::lower_bound(first, last, value) - first); });
+        // Una comparacin que no es std::less usa la bsqueda binaria clsica, con saltos.
+        const double branchy_time = time_search(queries, [first, last](std::uint32_t value)
+            {
+                return std::size_t(mySTL::lower_bound(first, last, value,
+                    [](std::uint32_t element, std::uint32_t key) { return element < key; }) - first);
+            });
+        const double branchless_time = time_search(queries, [first, last](std::uint32_t value)
+            { return std::size_t(mySTL::lower_bound(first, last, value) - first); });
+        const double eytzinger_time = time_search(queries, [&eytzinger](std::uint32_t value)
+            { return std::size_t(eytzinger.lower_bound(value) - eytzinger.begin()); });
+
+        std::printf("  %10zu  %6zu %s  %16.1f   %18.1f   %18.1f   %15.1f\n", count,
+            count * 4 >= (std::size_t(1) << 20) ? (count * 4) >> 20 : (count * 4) >> 10,
+            count * 4 >= (std::size_t(1) << 20) ? "MB" : "KB",
+            std_time, branchy_time, branchless_time, eytzinger_time);
+    }
+    std::printf("\n");
+
+    return 0;
+}
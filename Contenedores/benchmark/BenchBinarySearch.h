@@ -0,0 +1,16 @@
+#ifndef BENCH_BINARY_SEARCH_H
+#define BENCH_BINARY_SEARCH_H
+
+#include "BenchTimer.h"
+#include "../algorithm/my_algorithm.h"
+#include "../algorithm/my_sort.h"
+#include "../eytzinger_array/my_eytzinger_array.h"
+#include "../vector/my_vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+
+int benchBinarySearch();
+
+#endif /* BENCH_BINARY_SEARCH_H */
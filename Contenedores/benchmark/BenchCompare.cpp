@@ -0,0 +1,102 @@
+#include "BenchCompare.h"
+
+namespace
+{
+    /// La implementacin anterior de mySTL::equal: un ciclo con una rama por elemento.
+    template <typename ValueType>
+    __attribute__((noinline)) bool element_equal(const ValueType* first1, const ValueType* last1,
+        const ValueType* first2)
+    {
+        for (; first1 != last1; ++first1, ++first2)
+            if (*first1 != *first2)
+                return false;
+        return true;
+    }
+
+    /// La implementacin anterior de mySTL::lexicographical_compare.
+    template <typename ValueType>
+    __attribute__((noinline)) bool element_less(const ValueType* first1, const ValueType* last1,
+        const ValueType* first2, const ValueType* last2)
+    {
+        for (; first1 != last1; ++first1, ++first2)
+        {
+            if (first2 == last2 || *first2 < *first1)
+                return false;
+            if (*first1 < *first2)
+                return true;
+        }
+        return first2 != last2;
+    }
+
+    /**
+     * Compara dos claves de 1 MB que solo difieren en el ltimo elemento, con
+     * operator== y operator< del vector o con los ciclos anteriores, y guarda en
+     * los parmetros los microsegundos por comparacin de cada forma.
+     */
+    template <typename ValueType>
+    void compare_keys(double& element_us, double& equal_us, double& element_less_us, double& less_us)
+    {
+        const std::size_t count = (std::size_t(1) << 20) / sizeof(ValueType);
+        const int rounds = 200;
+        mySTL::vector<ValueType> key1(count, ValueType(3));
+        mySTL::vector<ValueType> key2(count, ValueType(3));
+        key2[count - 1] = ValueType(4);
+        // Que el compilador no suponga que las claves siguen iguales entre rondas.
+        do_not_optimize(key1.data());
+        do_not_optimize(key2.data());
+
+        bool result = false;
+        bench_timer timer;
+        for (int round = 0; round < rounds; ++round)
+        {
+            result ^= element_equal(key1.data(), key1.data() + count, key2.data());
+            do_not_optimize(result);
+        }
+        element_us = timer.seconds() * 1e6 / rounds;
+
+        timer.reset();
+        for (int round = 0; round < rounds; ++round)
+        {
+            result ^= (key1 == key2);
+            do_not_optimize(result);
+        }
+        equal_us = timer.seconds() * 1e6 / rounds;
+
+        timer.reset();
+        for (int round = 0; round < rounds; ++round)
+        {
+            result ^= element_less(key1.data(), key1.data() + count, key2.data(), key2.data() + count);
+            do_not_optimize(result);
+        }
+        element_less_us = timer.seconds() * 1e6 / rounds;
+
+        timer.reset();
+        for (int round = 0; round < rounds; ++round)
+        {
+            result ^= (key1 < key2);
+            do_not_optimize(result);
+        }
+        less_us = timer.seconds() * 1e6 / rounds;
+
+        do_not_optimize(result);
+    }
+}
+
+int benchCompare()
+{
+    std::printf("Comparar dos claves de 1 MB que difieren en el ultimo elemento (us por comparacion):\n");
+    std::printf("  tipo       == ciclo   == mySTL   < ciclo   < mySTL\n");
+
+    double times[4];
+    compare_keys<std::uint8_t>(times[0], times[1], times[2], times[3]);
+    std::printf("  uint8_t   %8.1f   %8.1f   %7.1f   %7.1f\n", times[0], times[1], times[2], times[3]);
+    compare_keys<std::int16_t>(times[0], times[1], times[2], times[3]);
+    std::printf("  int16_t   %8.1f   %8.1f   %7.1f   %7.1f\n", times[0], times[1], times[2], times[3]);
+    compare_keys<std::uint32_t>(times[0], times[1], times[2], times[3]);
+    std::printf("  uint32_t  %8.1f   %8.1f   %7.1f   %7.1f\n", times[0], times[1], times[2], times[3]);
+    compare_keys<std::int64_t>(times[0], times[1], times[2], times[3]);
+    std::printf("  int64_t   %8.1f   %8.1f   %7.1f   %7.1f\n", times[0], times[1], times[2], times[3]);
+    std::printf("\n");
+
+    return 0;
+}
@@ -0,0 +1,12 @@
+#ifndef BENCH_COMPARE_H
+#define BENCH_COMPARE_H
+
+#include "BenchTimer.h"
+#include "../vector/my_vector.h"
+
+#include <cstdint>
+#include <cstdio>
+
+int benchCompare();
+
+#endif /* BENCH_COMPARE_H */
@@ -0,0 +1,76 @@
+#include "BenchCopy.h"
+
+namespace
+{
+    /// La implementacin anterior de mySTL::copy: un ciclo elemento por elemento.
+    template <typename InputIterator, typename OutputIterator>
+    __attribute__((noinline)) OutputIterator element_copy(InputIterator first, InputIterator last,
+        OutputIterator result)
+    {
+        while (first != last)
+        {
+            *result = *first;
+            ++first;
+            ++result;
+        }
+        return result;
+    }
+
+    /**
+     * Copia @a count enteros de @a source a @a destination, repitiendo hasta
+     * copiar alrededor de 1 GB en total.
+     *
+     * @return Gigabytes por segundo.
+     */
+    template <bool UseMemmove>
+    double copy_speed(const int* source, int* destination, std::size_t count)
+    {
+        const std::size_t bytes = count * sizeof(int);
+        const std::size_t rounds = (bytes >= (std::size_t(1) << 30)) ? 1 : (std::size_t(1) << 30) / bytes;
+
+        bench_timer timer;
+        for (std::size_t round = 0; round < rounds; ++round)
+        {
+            if constexpr (UseMemmove)
+                mySTL::copy(source, source + count, destination);
+            else
+                element_copy(source, source + count, destination);
+            do_not_optimize(destination[0]);
+        }
+        double seconds = timer.seconds();
+        return double(bytes) * double(rounds) / seconds / 1e9;
+    }
+}
+
+int benchCopy()
+{
+    const std::size_t max_bytes = std::size_t(1) << 30;
+    int* source = static_cast<int*>(std::malloc(max_bytes));
+    int* destination = static_cast<int*>(std::malloc(max_bytes));
+    if (source == nullptr || destination == nullptr)
+    {
+        std::printf("mySTL::copy: no hay memoria para los arreglos de prueba\n\n");
+        std::free(source);
+        std::free(destination);
+        return 1;
+    }
+
+    const std::size_t max_count = max_bytes / sizeof(int);
+    for (std::size_t index = 0; index < max_count; ++index)
+        source[index] = int(index);
+    element_copy(source, source + max_count, destination);
+
+    std::printf("mySTL::copy de int (GB/s):\n");
+    std::printf("         bytes   elemento por elemento   memmove\n");
+    for (std::size_t bytes = 16; bytes <= max_bytes; bytes *= 4)
+    {
+        const std::size_t count = bytes / sizeof(int);
+        std::printf("  %12zu   %21.2f   %7.2f\n", bytes,
+            copy_speed<false>(source, destination, count), copy_speed<true>(source, destination, count));
+    }
+    std::printf("\n");
+
+    std::free(source);
+    std::free(destination);
+    return 0;
+}
@@ -0,0 +1,12 @@
+#ifndef BENCH_COPY_H
+#define BENCH_COPY_H
+
+#include "BenchTimer.h"
+#include "../algorithm/my_algorithm.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+int benchCopy();
+
+#endif /* BENCH_COPY_H */
@@ -0,0 +1,136 @@
+#include "BenchDeque.h"
+
+namespace
+{
+    /**
+     * Repite @a cycles veces un ciclo de llenar el contenedor con @a count
+     * elementos y vaciarlo con clear, como un bfer que se reutiliza en cada cuadro.
+     *
+     * @return Nanosegundos promedio por elemento.
+     */
+    template <typename Container, typename ValueType>
+    double clear_and_refill(std::size_t count, std::size_t cycles, const ValueType& value)
+    {
+        Container container;
+        bench_timer timer;
+
+        for (std::size_t cycle = 0; cycle < cycles; ++cycle)
+        {
+            for (std::size_t num = 0; num < count; ++num)
+                container.push_back(value);
+            do_not_optimize(container.back());
+            container.clear();
+        }
+
+        double seconds = timer.seconds();
+        return seconds * 1e9 / double(count * cycles);
+    }
+
+    /**
+     * Inserta y luego elimina @a operations elementos en posiciones seudoaleatorias
+     * de un contenedor con @a count cadenas.
+     *
+     * @return Nanosegundos promedio por operacin (insercin o eliminacin).
+     */
+    template <typename Container>
+    double middle_insert_erase(std::size_t count, std::size_t operations)
+    {
+        // Cadenas ms largas que el bfer interno, para que copiarlas asigne memoria.
+        const std::string text(40, 'x');
+        Container container;
+        for (std::size_t num = 0; num < count; ++num)
+            container.push_back(text);
+
+        unsigned int seed = 12345;
+        bench_timer timer;
+
+        for (std::size_t num = 0; num < operations; ++num)
+        {
+            seed = seed * 1103515245 + 12345;
+            container.insert(container.begin() + (seed >> 8) % (container.size() + 1), text);
+        }
+        for (std::size_t num = 0; num < operations; ++num)
+        {
+            seed = seed * 1103515245 + 12345;
+            container.erase(container.begin() + (seed >> 8) % container.size());
+        }
+
+        double seconds = timer.seconds();
+        do_not_optimize(container.front());
+        return seconds * 1e9 / double(2 * operations);
+    }
+
+    /**
+     * Usa un deque como cola FIFO con @a live elementos: agrega al final y saca
+     * del inicio @a operations veces, e imprime el tiempo y los contadores
+     * de mantenimiento del mapa.
+     */
+    void long_lived_fifo(std::size_t live, std::size_t operations)
+    {
+        mySTL::deque<int> fifo;
+        for (std::size_t num = 0; num < live; ++num)
+            fifo.push_back(int(num));
+
+        bench_timer timer;
+        for (std::size_t num = 0; num < operations; ++num)
+        {
+            fifo.push_back(int(num));
+            fifo.pop_front();
+        }
+        double seconds = timer.seconds();
+        do_not_optimize(fifo.front());
+
+        // Cada fragmento de 512 bytes guarda 128 enteros.
+        const mySTL::deque<int>::map_statistics& stats = fifo.map_stats();
+        double chunks = double(operations) / 128.0;
+        std::printf("  %9zu   %9.2f   %10zu   %13zu   %12.3f\n", live,
+            seconds * 1e9 / double(operations), stats.recenters, stats.reallocations,
+            double(stats.moved_nodes) / chunks);
+    }
+}
+
+int benchDeque()
+{
+    const std::size_t total = 4000000;
+
+    std::printf("Ciclos de llenar y vaciar con clear, int (ns por elemento):\n");
+    std::printf("  elementos         deque    std::deque\n");
+
+    for (std::size_t count = 16; count <= 1000000; count *= 25)
+    {
+        std::printf("  %9zu   %11.2f   %11.2f\n", count,
+            clear_and_refill<mySTL::deque<int>>(count, total / count, 7),
+            clear_and_refill<std::deque<int>>(count, total / count, 7));
+    }
+
+    std::printf("\nCiclos de llenar y vaciar con clear, std::string (ns por elemento):\n");
+    std::printf("  elementos         deque    std::deque\n");
+
+    // Cadenas ms largas que el bfer interno, para que cada una asigne memoria.
+    const std::string text(40, 'x');
+    for (std::size_t count = 16; count <= 1000000; count *= 25)
+    {
+        std::printf("  %9zu   %11.2f   %11.2f\n", count,
+            clear_and_refill<mySTL::deque<std::string>>(count, total / 4 / count, text),
+            clear_and_refill<std::deque<std::string>>(count, total / 4 / count, text));
+    }
+
+    std::printf("\nInsercion y eliminacion en posiciones aleatorias, std::string (ns por operacion):\n");
+    std::printf("  elementos         deque    std::deque\n");
+
+    for (std::size_t count = 1000; count <= 100000; count *= 10)
+    {
+        std::printf("  %9zu   %11.1f   %11.1f\n", count,
+            middle_insert_erase<mySTL::deque<std::string>>(count, 2000),
+            middle_insert_erase<std::deque<std::string>>(count, 2000));
+    }
+
+    std::printf("\nCola FIFO de larga duracion, 100 millones de push_back + pop_front:\n");
+    std::printf("  elementos     ns/op   recentrados   reasignaciones   nodos/fragmento\n");
+
+    for (std::size_t live = 0; live <= 1000000; live = (live == 0) ? 100 : live * 100)
+        long_lived_fifo(live, 100000000);
+    std::printf("\n");
+
+    return 0;
+}
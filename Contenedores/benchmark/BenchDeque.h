@@ -0,0 +1,13 @@
+#ifndef BENCH_DEQUE_H
+#define BENCH_DEQUE_H
+
+#include "BenchTimer.h"
+#include "../deque/my_deque.h"
+
+#include <cstdio>
+#include <deque>
+#include <string>
+
+int benchDeque();
+
+#endif /* BENCH_DEQUE_H */
@@ -0,0 +1,82 @@
+#include "BenchExecution.h"
+
+namespace
+{
+    /// Los algoritmos que se miden.
+    const char* algorithm_names[] = { "fill", "copy", "equal", "for_each", "transform", "reduce", "count_if" };
+    const int algorithm_count = 7;
+
+    /**
+     * Ejecuta el algoritmo nmero @a algorithm sobre @a input y @a output con @a policy.
+     *
+     * @return Milisegundos transcurridos.
+     */
+    template <typename ExecutionPolicy>
+    double run(const ExecutionPolicy& policy, int algorithm, mySTL::vector<double>& input,
+        mySTL::vector<double>& output)
+    {
+        bench_timer timer;
+        switch (algorithm)
+        {
+        case 0:
+            mySTL::fill(policy, output.begin(), output.end(), 1.5);
+            break;
+        case 1:
+            mySTL::copy(policy, input.begin(), input.end(), output.begin());
+            break;
+        case 2:
+            do_not_optimize(mySTL::equal(policy, input.begin(), input.end(), output.begin()));
+            break;
+        case 3:
+            mySTL::for_each(policy, output.begin(), output.end(), [](double& element) { element = std::sqrt(element) + 1.0; });
+            break;
+        case 4:
+            mySTL::transform(policy, input.begin(), input.end(), output.begin(),
+                [](double element) { return std::sin(element) * std::cos(element); });
+            break;
+        case 5:
+            do_not_optimize(mySTL::reduce(policy, input.begin(), input.end(), 0.0));
+            break;
+        default:
+            do_not_optimize(mySTL::count_if(policy, input.begin(), input.end(), [](double element) { return element > 0.5; }));
+            break;
+        }
+        double milliseconds = timer.seconds() * 1e3;
+        do_not_optimize(output.data());
+        return milliseconds;
+    }
+}
+
+int benchExecution()
+{
+    const std::size_t count = 16 * 1024 * 1024;
+    mySTL::vector<double> input(count);
+    mySTL::vector<double> output(count);
+    for (std::size_t index = 0; index < count; ++index)
+    {
+        input[index] = double(index % 1000) / 1000.0;
+        output[index] = 0.0; // Tocar las pginas antes de medir.
+    }
+
+    const unsigned int max_threads = bench_max_threads();
+
+    std::printf("Algoritmos con politicas de ejecucion sobre %zu doubles (%u nucleos):\n", count, max_threads);
+    std::printf("  algoritmo   seq (ms)   hilos   par (ms)   aceleracion\n");
+
+    for (int algorithm = 0; algorithm < algorithm_count; ++algorithm)
+    {
+        double sequential = run(mySTL::execution::seq, algorithm, input, output);
+        std::printf("  %-9s   %8.2f\n", algorithm_names[algorithm], sequential);
+
+        for_each_thread_count(max_threads, [&](unsigned int threads)
+        {
+            // El hilo que llama al algoritmo tambin ejecuta partes.
+            mySTL::thread_pool pool(threads > 1 ? threads - 1 : 1);
+            double parallel = run(mySTL::execution::par.on(pool), algorithm, input, output);
+            std::printf("                         %5u   %8.2f   %10.2fx\n", threads, parallel, sequential / parallel);
+        });
+    }
+    std::printf("\n");
+
+    return 0;
+}
@@ -0,0 +1,14 @@
+#ifndef BENCH_EXECUTION_H
+#define BENCH_EXECUTION_H
+
+#include "BenchTimer.h"
+#include "../algorithm/my_execution.h"
+#include "../vector/my_vector.h"
+
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+int benchExecution();
+
+#endif /* BENCH_EXECUTION_H */
@@ -0,0 +1,91 @@
+#include "BenchFill.h"
+
+namespace
+{
+    /// La implementacin anterior de mySTL::fill: un ciclo elemento por elemento.
+    template <typename ValueType>
+    __attribute__((noinline)) void element_fill(ValueType* first, ValueType* last, ValueType value)
+    {
+        while (first != last)
+        {
+            *first = value;
+            ++first;
+        }
+    }
+
+    /// Las formas de rellenar que se comparan.
+    enum class fill_method { element, automatic, temporal, nontemporal };
+
+    /**
+     * Rellena @a count enteros de @a buffer con @a value, repitiendo hasta escribir
+     * alrededor de 2 GB en total.
+     *
+     * @return Gigabytes por segundo.
+     */
+    double fill_speed(std::uint32_t* buffer, std::size_t count, std::uint32_t value, fill_method method)
+    {
+        const std::size_t bytes = count * sizeof(std::uint32_t);
+        const std::size_t total = std::size_t(2) << 30;
+        const std::size_t rounds = (bytes >= total) ? 1 : total / bytes;
+
+        bench_timer timer;
+        for (std::size_t round = 0; round < rounds; ++round)
+        {
+            switch (method)
+            {
+            case fill_method::element:
+                element_fill(buffer, buffer + count, value);
+                break;
+            case fill_method::automatic:
+                mySTL::fill(buffer, buffer + count, value);
+                break;
+            case fill_method::temporal:
+            case fill_method::nontemporal:
+#ifdef MY_SIMD_X86
+                if (mySTL::detect_simd_level() == mySTL::simd_level::avx2)
+                    mySTL::avx2_fill(buffer, buffer + count, value, method == fill_method::nontemporal);
+                else
+                    mySTL::sse2_fill(buffer, buffer + count, value, method == fill_method::nontemporal);
+#else
+                mySTL::fill(buffer, buffer + count, value);
+#endif
+                break;
+            }
+            do_not_optimize(buffer[count / 2]);
+        }
+        double seconds = timer.seconds();
+        return double(bytes) * double(rounds) / seconds / 1e9;
+    }
+}
+
+int benchFill()
+{
+    const std::size_t max_bytes = std::size_t(2) << 30;
+    std::uint32_t* buffer = static_cast<std::uint32_t*>(std::malloc(max_bytes));
+    if (buffer == nullptr)
+    {
+        std::printf("mySTL::fill: no hay memoria para el arreglo de prueba\n\n");
+        return 1;
+    }
+    // Tocar todas las pginas antes de medir.
+    element_fill(buffer, buffer + max_bytes / sizeof(std::uint32_t), std::uint32_t(1));
+
+    const char* level_names[] = { "escalar", "SSE2", "AVX2" };
+    std::printf("mySTL::fill de uint32_t (GB/s, %s, umbral no temporal: %zu MB):\n",
+        level_names[int(mySTL::detect_simd_level())], std::size_t(MY_NONTEMPORAL_THRESHOLD) >> 20);
+    std::printf("         bytes   elemento por elemento   fill(0)   fill(0x01020304)   vectorial   no temporal\n");
+    for (std::size_t bytes = 1024; bytes <= max_bytes; bytes *= 8)
+    {
+        const std::size_t count = bytes / sizeof(std::uint32_t);
+        std::printf("  %12zu   %21.2f   %7.2f   %16.2f   %9.2f   %11.2f\n", bytes,
+            fill_speed(buffer, count, 0x01020304, fill_method::element),
+            fill_speed(buffer, count, 0, fill_method::automatic),
+            fill_speed(buffer, count, 0x01020304, fill_method::automatic),
+            fill_speed(buffer, count, 0x01020304, fill_method::temporal),
+            fill_speed(buffer, count, 0x01020304, fill_method::nontemporal));
+    }
+    std::printf("\n");
+
+    std::free(buffer);
+    return 0;
+}
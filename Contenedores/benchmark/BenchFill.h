@@ -0,0 +1,14 @@
+#ifndef BENCH_FILL_H
+#define BENCH_FILL_H
+
+#include "BenchTimer.h"
+#include "../algorithm/my_algorithm.h"
+#include "../algorithm/my_simd.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+int benchFill();
+
+#endif /* BENCH_FILL_H */
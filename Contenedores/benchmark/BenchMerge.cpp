@@ -0,0 +1,117 @@
+#include "BenchMerge.h"
+
+#include <random>
+
+namespace
+{
+    typedef std::pair<const std::uint32_t*, const std::uint32_t*> run_type;
+
+    /**
+     * Mezcla las secuencias con un montculo de pares (valor, secuencia): la forma
+     * habitual de mezclar k secuencias, para comparar con el rbol de perdedores.
+     */
+    std::uint32_t* heap_merge(const mySTL::vector<run_type>& runs, std::uint32_t* result)
+    {
+        typedef std::pair<std::uint32_t, std::size_t> entry;
+        mySTL::priority_queue<entry, mySTL::vector<entry>, std::greater<entry>> heap;
+        mySTL::vector<run_type> cursors(runs.size());
+        for (std::size_t index = 0; index < runs.size(); ++index)
+        {
+            cursors[index] = runs[index];
+            if (cursors[index].first != cursors[index].second)
+                heap.push(entry(*cursors[index].first++, index));
+        }
+
+        while (!heap.empty())
+        {
+            const entry top = heap.top();
+            *result++ = top.first;
+            run_type& cursor = cursors[top.second];
+            if (cursor.first != cursor.second)
+                heap.pop_push(entry(*cursor.first++, top.second));
+            else
+                heap.pop();
+        }
+        return result;
+    }
+
+    /// Retorna los nanosegundos por elemento de ordenar copias de @a input con @a sort_function.
+    template <typename Sort>
+    double time_sort(const mySTL::vector<std::uint32_t>& input, mySTL::vector<std::uint32_t>& work,
+        Sort sort_function)
+    {
+        const int rounds = 3;
+        double seconds = 0;
+        for (int round = 0; round < rounds; ++round)
+        {
+            mySTL::copy(input.data(), input.data() + input.size(), work.data());
+            do_not_optimize(work.data());
+            bench_timer timer;
+            sort_function(work.data(), work.data() + work.size());
+            seconds += timer.seconds();
+            do_not_optimize(work.data());
+        }
+        return seconds * 1e9 / (double(rounds) * double(input.size()));
+    }
+}
+
+int benchMerge()
+{
+    const std::size_t count = std::size_t(1) << 20;
+    std::mt19937 generator(11);
+    mySTL::vector<std::uint32_t> input(count);
+    mySTL::vector<std::uint32_t> work(count);
+    for (std::size_t index = 0; index < count; ++index)
+        input[index] = std::uint32_t(generator());
+
+    std::printf("Ordenar de forma estable 2^20 enteros de 32 bits (ns por elemento):\n");
+    std::printf("  std::stable_sort       %8.2f\n", time_sort(input, work,
+        [](std::uint32_t* first, std::uint32_t* last) { std::stable_sort(first, last); }));
+    std::printf("  mySTL::stable_sort     %8.2f\n", time_sort(input, work,
+        [](std::uint32_t* first, std::uint32_t* last) { mySTL::stable_sort(first, last); }));
+    std::printf("  mySTL, sin memoria     %8.2f\n", time_sort(input, work,
+        [](std::uint32_t* first, std::uint32_t* last)
+        {
+            std::less<std::uint32_t> compare;
+            mySTL::stable_sort_adaptive(first, last, static_cast<std::uint32_t*>(nullptr), 0, compare);
+        }));
+    std::printf("\n");
+
+    // Mezclar 2^24 elementos repartidos en k secuencias ordenadas.
+    const std::size_t total = std::size_t(1) << 24;
+    mySTL::vector<std::uint32_t> data(total);
+    mySTL::vector<std::uint32_t> output(total);
+    mySTL::fill(output.data(), output.data() + total, 0u);
+
+    std::printf("Mezclar 2^24 enteros de 32 bits en k secuencias (millones de elementos por segundo):\n");
+    std::printf("        k   arbol de perdedores   monticulo\n");
+    for (std::size_t runs_count = 2; runs_count <= 1024; runs_count *= 2)
+    {
+        for (std::size_t index = 0; index < total; ++index)
+            data[index] = std::uint32_t(generator());
+
+        mySTL::vector<run_type> runs;
+        const std::size_t run_length = total / runs_count;
+        for (std::size_t run = 0; run < runs_count; ++run)
+        {
+            std::uint32_t* run_first = data.data() + run * run_length;
+            mySTL::sort(run_first, run_first + run_length);
+            runs.push_back(run_type(run_first, run_first + run_length));
+        }
+
+        bench_timer timer;
+        mySTL::multiway_merge(runs.begin(), runs.end(), output.data());
+        const double tree_seconds = timer.seconds();
+        do_not_optimize(output.data());
+
+        timer.reset();
+        heap_merge(runs, output.data());
+        const double heap_seconds = timer.seconds();
+        do_not_optimize(output.data());
+
+        std::printf("  %7zu   %19.1f   %9.1f\n", runs_count, total / tree_seconds / 1e6, total / heap_seconds / 1e6);
+    }
+    std::printf("\n");
+
+    return 0;
+}
@@ -0,0 +1,18 @@
+#ifndef BENCH_MERGE_H
+#define BENCH_MERGE_H
+
+#include "BenchTimer.h"
+#include "../algorithm/my_sort.h"
+#include "../algorithm/my_merge.h"
+#include "../queue/my_queue.h"
+#include "../vector/my_vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <utility>
+
+int benchMerge();
+
+#endif /* BENCH_MERGE_H */
@@ -0,0 +1,80 @@
+#include "BenchMonotonicQueue.h"
+
+namespace
+{
+    /**
+     * Calcula el mnimo de una ventana de @a window mediciones en cada uno de
+     * @a ticks ciclos, recorriendo la ventana completa en cada ciclo.
+     *
+     * @return Nanosegundos promedio por ciclo.
+     */
+    double rescan_min(std::size_t window, std::size_t ticks)
+    {
+        mySTL::deque<int> samples;
+        unsigned int seed = 12345;
+        long long sum = 0;
+        bench_timer timer;
+
+        for (std::size_t tick = 0; tick < ticks; ++tick)
+        {
+            seed = seed * 1103515245 + 12345;
+            samples.push_back(int(seed >> 8));
+            if (samples.size() > window)
+                samples.pop_front();
+
+            int minimum = samples.front();
+            for (auto iteration = samples.begin(); iteration != samples.end(); ++iteration)
+                if (*iteration < minimum)
+                    minimum = *iteration;
+            sum += minimum;
+        }
+
+        double seconds = timer.seconds();
+        do_not_optimize(sum);
+        return seconds * 1e9 / double(ticks);
+    }
+
+    /**
+     * Calcula el mnimo de una ventana de @a window mediciones en cada uno de
+     * @a ticks ciclos con una monotonic_queue.
+     *
+     * @return Nanosegundos promedio por ciclo.
+     */
+    double monotonic_min(std::size_t window, std::size_t ticks)
+    {
+        mySTL::monotonic_queue<int> samples;
+        unsigned int seed = 12345;
+        long long sum = 0;
+        bench_timer timer;
+
+        for (std::size_t tick = 0; tick < ticks; ++tick)
+        {
+            seed = seed * 1103515245 + 12345;
+            samples.push(int(seed >> 8), (long long)(tick));
+            // Ventana por tiempo: conservar los ltimos window ciclos.
+            samples.evict_before((long long)(tick) - (long long)(window) + 1);
+            sum += samples.top();
+        }
+
+        double seconds = timer.seconds();
+        do_not_optimize(sum);
+        return seconds * 1e9 / double(ticks);
+    }
+}
+
+int benchMonotonicQueue()
+{
+    std::printf("Minimo de una ventana deslizante (ns por ciclo):\n");
+    std::printf("    ventana   recorrer deque   monotonic_queue\n");
+
+    for (std::size_t window = 16; window <= 65536; window *= 16)
+    {
+        // Menos ciclos para las ventanas grandes, que recorrer hace lentas.
+        std::size_t ticks = (window <= 256) ? 2000000 : 100000;
+        std::printf("  %9zu   %14.1f   %15.1f\n", window,
+            rescan_min(window, ticks), monotonic_min(window, ticks));
+    }
+    std::printf("\n");
+
+    return 0;
+}
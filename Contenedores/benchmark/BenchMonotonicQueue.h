@@ -0,0 +1,12 @@
+#ifndef BENCH_MONOTONIC_QUEUE_H
+#define BENCH_MONOTONIC_QUEUE_H
+
+#include "BenchTimer.h"
+#include "../deque/my_deque.h"
+#include "../monotonic_queue/my_monotonic_queue.h"
+
+#include <cstdio>
+
+int benchMonotonicQueue();
+
+#endif /* BENCH_MONOTONIC_QUEUE_H */
@@ -0,0 +1,146 @@
+#include "BenchMpmcQueue.h"
+
+namespace
+{
+    /// Un deque protegido por un mutex, compartido por todos los productores y consumidores.
+    template <typename ValueType>
+    struct locked_deque
+    {
+        std::mutex mutex;
+        mySTL::deque<ValueType> deque;
+
+        bool try_push(const ValueType& value)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            deque.push_back(value);
+            return true;
+        }
+
+        bool try_pop(ValueType& value)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (deque.empty())
+                return false;
+            value = deque.front();
+            deque.pop_front();
+            return true;
+        }
+
+        std::size_t push_n(const ValueType* first, std::size_t count)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            deque.append_range(first, first + count);
+            return count;
+        }
+
+        std::size_t pop_n(ValueType* result, std::size_t max_count)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return deque.drain_front(result, max_count);
+        }
+    };
+
+    /**
+     * Reparte @a item_count enteros entre @a thread_count productores y los
+     * recibe con @a thread_count consumidores. Si @a batch es mayor que 1, usa
+     * push_n/pop_n con lotes de ese tamao.
+     *
+     * @return Millones de elementos por segundo.
+     */
+    template <typename Queue>
+    double throughput(Queue& queue, unsigned int thread_count, long long item_count, std::size_t batch)
+    {
+        const long long items_per_producer = item_count / thread_count;
+        const long long total = items_per_producer * thread_count;
+        std::atomic<long long> received(0);
+        std::atomic<long long> sum(0);
+
+        mySTL::vector<std::thread> producers(thread_count);
+        mySTL::vector<std::thread> consumers(thread_count);
+
+        bench_timer timer;
+
+        for (unsigned int thread = 0; thread < thread_count; ++thread)
+        {
+            producers[thread] = std::thread([&queue, items_per_producer, batch]()
+            {
+                long long items[64];
+                for (long long item = 0; item < items_per_producer; )
+                {
+                    if (batch == 1)
+                    {
+                        if (queue.try_push(item))
+                            ++item;
+                        else
+                            std::this_thread::yield(); // Cola llena: ceder el procesador.
+                        continue;
+                    }
+
+                    std::size_t count = std::size_t( mySTL::min((long long)(batch), items_per_producer - item) );
+                    for (std::size_t index = 0; index < count; ++index)
+                        items[index] = item + index;
+
+                    std::size_t pushed = 0;
+                    while ((pushed += queue.push_n(items + pushed, count - pushed)) < count)
+                        std::this_thread::yield();
+                    item += count;
+                }
+            });
+
+            consumers[thread] = std::thread([&queue, &received, &sum, total, batch]()
+            {
+                long long items[64];
+                long long local_sum = 0;
+                while (received.load(std::memory_order_relaxed) < total)
+                {
+                    std::size_t count = ( (batch == 1) ? std::size_t(queue.try_pop(items[0]))
+                        : queue.pop_n(items, batch) );
+                    if (count == 0)
+                    {
+                        std::this_thread::yield(); // Cola vaca: ceder el procesador.
+                        continue;
+                    }
+                    for (std::size_t index = 0; index < count; ++index)
+                        local_sum += items[index];
+                    received.fetch_add(count, std::memory_order_relaxed);
+                }
+                sum += local_sum;
+            });
+        }
+
+        for (unsigned int thread = 0; thread < thread_count; ++thread)
+        {
+            producers[thread].join();
+            consumers[thread].join();
+        }
+
+        double seconds = timer.seconds();
+        do_not_optimize(sum.load());
+        return total / seconds / 1e6;
+    }
+}
+
+int benchMpmcQueue()
+{
+    const long long item_count = 2000000;
+
+    std::printf("Paso de %lld enteros entre N productores y N consumidores (Melementos/s):\n", item_count);
+    std::printf("      N   deque + mutex   mpmc_queue   deque (lotes 32)   mpmc (lotes 32)\n");
+
+    for (unsigned int thread_count = 1; thread_count <= 32; thread_count *= 2)
+    {
+        locked_deque<long long> locked1, locked2;
+        mySTL::mpmc_queue<long long> queue1(4096), queue2(4096);
+
+        double locked_single = throughput(locked1, thread_count, item_count, 1);
+        double mpmc_single = throughput(queue1, thread_count, item_count, 1);
+        double locked_batch = throughput(locked2, thread_count, item_count, 32);
+        double mpmc_batch = throughput(queue2, thread_count, item_count, 32);
+
+        std::printf("  %5u   %13.2f   %10.2f   %16.2f   %15.2f\n",
+            thread_count, locked_single, mpmc_single, locked_batch, mpmc_batch);
+    }
+    std::printf("\n");
+
+    return 0;
+}
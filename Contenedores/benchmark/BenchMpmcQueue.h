@@ -0,0 +1,16 @@
+#ifndef BENCH_MPMC_QUEUE_H
+#define BENCH_MPMC_QUEUE_H
+
+#include "BenchTimer.h"
+#include "../deque/my_deque.h"
+#include "../mpmc_queue/my_mpmc_queue.h"
+#include "../vector/my_vector.h"
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+int benchMpmcQueue();
+
+#endif /* BENCH_MPMC_QUEUE_H */
@@ -0,0 +1,91 @@
+#include "BenchParallel.h"
+
+namespace
+{
+    /// Trabajo por elemento: unas cuantas operaciones de punto flotante.
+    inline void update(float& element)
+    {
+        element = element * 0.999f + 0.5f;
+        element = element * element * 0.001f + element;
+    }
+
+    /**
+     * Divide [first, last) en @a parts partes iguales sin alinear los lmites y
+     * recorre cada parte con el iterador, elemento por elemento.
+     */
+    template <typename Iterator>
+    void naive_for_each(mySTL::thread_pool& pool, Iterator first, Iterator last, std::size_t parts)
+    {
+        const std::size_t count = std::size_t(last - first);
+        mySTL::task_group group(pool);
+        for (std::size_t part = 0; part < parts; ++part)
+        {
+            // Cada lmite cuesta una divisin en operator+ del iterador de deque.
+            Iterator part_first = first + (count * part / parts);
+            Iterator part_last = first + (count * (part + 1) / parts);
+            group.run([part_first, part_last]()
+            {
+                for (Iterator element = part_first; element != part_last; ++element)
+                    update(*element);
+            });
+        }
+        group.wait();
+    }
+
+    /**
+     * Aplica update a todo el rango, @a rounds veces, con parallel_for_each o con
+     * naive_for_each.
+     *
+     * @return Milisegundos por recorrido.
+     */
+    template <bool Aligned, typename Iterator>
+    double run(mySTL::thread_pool& pool, Iterator first, Iterator last, int rounds)
+    {
+        bench_timer timer;
+        for (int round = 0; round < rounds; ++round)
+        {
+            if constexpr (Aligned)
+                mySTL::parallel_for_each(pool, first, last, [](float& element) { update(element); });
+            else
+                naive_for_each(pool, first, last, 4 * pool.size());
+        }
+        double seconds = timer.seconds();
+        do_not_optimize(*first);
+        return seconds * 1e3 / rounds;
+    }
+}
+
+int benchParallel()
+{
+    const std::size_t count = 16 * 1024 * 1024;
+    const int rounds = 5;
+
+    mySTL::deque<float> deque1;
+    for (std::size_t index = 0; index < count; ++index)
+        deque1.push_back(float(index % 1000));
+    mySTL::vector<float> vector1(count, 1.0f);
+
+    const unsigned int max_threads = bench_max_threads();
+
+    std::printf("parallel_for_each sobre %zu floats (%u nucleos, ms por recorrido):\n", count, max_threads);
+    std::printf("  hilos   deque sin alinear   deque alineado   vector sin alinear   vector alineado\n");
+
+    double base_time = 0;
+    for_each_thread_count(max_threads, [&](unsigned int threads)
+    {
+        mySTL::thread_pool pool(threads);
+
+        double deque_naive = run<false>(pool, deque1.begin(), deque1.end(), rounds);
+        double deque_aligned = run<true>(pool, deque1.begin(), deque1.end(), rounds);
+        double vector_naive = run<false>(pool, vector1.begin(), vector1.end(), rounds);
+        double vector_aligned = run<true>(pool, vector1.begin(), vector1.end(), rounds);
+        if (threads == 1)
+            base_time = deque_aligned;
+
+        std::printf("  %5u   %17.2f   %14.2f   %18.2f   %15.2f   (aceleracion del deque: %.2fx)\n",
+            threads, deque_naive, deque_aligned, vector_naive, vector_aligned, base_time / deque_aligned);
+    });
+    std::printf("\n");
+
+    return 0;
+}
@@ -0,0 +1,14 @@
+#ifndef BENCH_PARALLEL_H
+#define BENCH_PARALLEL_H
+
+#include "BenchTimer.h"
+#include "../deque/my_deque.h"
+#include "../vector/my_vector.h"
+#include "../work_stealing/my_parallel.h"
+
+#include <cstdio>
+#include <thread>
+
+int benchParallel();
+
+#endif /* BENCH_PARALLEL_H */
@@ -0,0 +1,132 @@
+#include "BenchPriorityQueue.h"
+
+namespace
+{
+    /// Llena @a values con @a count enteros pseudoaleatorios.
+    void random_values(std::vector<int>& values, std::size_t count)
+    {
+        unsigned int seed = 12345;
+        values.resize(count);
+        for (int& value : values)
+        {
+            seed = seed * 1103515245 + 12345;
+            value = int(seed >> 1);
+        }
+    }
+
+    /**
+     * Agrega todos los @a values a una cola de prioridad vaca y despus los saca.
+     *
+     * @return Nanosegundos promedio por par push y pop.
+     */
+    template <typename PriorityQueue>
+    double push_then_pop(const std::vector<int>& values)
+    {
+        PriorityQueue heap;
+        long long sum = 0;
+        bench_timer timer;
+
+        for (int value : values)
+            heap.push(value);
+        while (!heap.empty())
+        {
+            sum += heap.top();
+            heap.pop();
+        }
+
+        double seconds = timer.seconds();
+        do_not_optimize(sum);
+        return seconds * 1e9 / double(values.size());
+    }
+
+    /**
+     * Simula un planificador con @a live elementos: cada ciclo saca el mnimo y
+     * agrega un elemento nuevo, con pop y push o con @a pop_push.
+     *
+     * @return Nanosegundos promedio por ciclo.
+     */
+    template <typename PriorityQueue, bool UsePopPush>
+    double replace_top(const std::vector<int>& values, std::size_t live)
+    {
+        PriorityQueue heap(values.begin(), values.begin() + live);
+        long long sum = 0;
+        bench_timer timer;
+
+        for (std::size_t index = live; index < values.size(); ++index)
+        {
+            sum += heap.top();
+            if constexpr (UsePopPush)
+                heap.pop_push(values[index]);
+            else
+            {
+                heap.pop();
+                heap.push(values[index]);
+            }
+        }
+
+        double seconds = timer.seconds();
+        do_not_optimize(sum);
+        return seconds * 1e9 / double(values.size() - live);
+    }
+
+    /**
+     * Forma un montculo con los @a values, agregndolos de uno en uno o todos
+     * juntos con push_range.
+     *
+     * @return Nanosegundos promedio por elemento.
+     */
+    template <bool UsePushRange>
+    double build(const std::vector<int>& values)
+    {
+        bench_timer timer;
+        mySTL::priority_queue<int> heap;
+        if constexpr (UsePushRange)
+            heap.push_range(values.begin(), values.end());
+        else
+            for (int value : values)
+                heap.push(value);
+
+        double seconds = timer.seconds();
+        do_not_optimize(heap.top());
+        return seconds * 1e9 / double(values.size());
+    }
+
+    typedef std::priority_queue<int> std_heap;
+    typedef mySTL::priority_queue<int, mySTL::vector<int>, std::less<int>, 2> binary_heap;
+    typedef mySTL::priority_queue<int, mySTL::vector<int>, std::less<int>, 4> quaternary_heap;
+    typedef mySTL::priority_queue<int, mySTL::vector<int>, std::less<int>, 8> octonary_heap;
+}
+
+int benchPriorityQueue()
+{
+    std::vector<int> values;
+
+    std::printf("priority_queue: push de n elementos y pop de todos (ns por par):\n");
+    std::printf("           n   std::priority_queue   d = 2   d = 4   d = 8\n");
+    for (std::size_t count = 1000; count <= 1000000; count *= 10)
+    {
+        random_values(values, count);
+        std::printf("  %10zu   %19.1f   %5.1f   %5.1f   %5.1f\n", count,
+            push_then_pop<std_heap>(values), push_then_pop<binary_heap>(values),
+            push_then_pop<quaternary_heap>(values), push_then_pop<octonary_heap>(values));
+    }
+
+    std::printf("priority_queue: reemplazar el tope con 100000 elementos (ns por ciclo):\n");
+    random_values(values, 2100000);
+    std::printf("    std pop + push   d = 4 pop + push   d = 4 pop_push\n");
+    std::printf("    %14.1f   %16.1f   %14.1f\n",
+        replace_top<std_heap, false>(values, 100000),
+        replace_top<quaternary_heap, false>(values, 100000),
+        replace_top<quaternary_heap, true>(values, 100000));
+
+    std::printf("priority_queue: formar un montculo de 1000000 elementos (ns por elemento):\n");
+    std::printf("    datos         push uno a uno   push_range\n");
+    random_values(values, 1000000);
+    std::printf("    aleatorios    %14.1f   %10.1f\n", build<false>(values), build<true>(values));
+    // En orden ascendente cada push sube el elemento hasta la raz.
+    for (std::size_t index = 0; index < values.size(); ++index)
+        values[index] = int(index);
+    std::printf("    ascendentes   %14.1f   %10.1f\n\n", build<false>(values), build<true>(values));
+
+    return 0;
+}
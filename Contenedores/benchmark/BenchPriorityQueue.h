@@ -0,0 +1,13 @@
+#ifndef BENCH_PRIORITY_QUEUE_H
+#define BENCH_PRIORITY_QUEUE_H
+
+#include "BenchTimer.h"
+#include "../queue/my_queue.h"
+
+#include <cstdio>
+#include <queue>
+#include <vector>
+
+int benchPriorityQueue();
+
+#endif /* BENCH_PRIORITY_QUEUE_H */
@@ -0,0 +1,95 @@
+#include "BenchRadixSort.h"
+
+#include <random>
+
+// Tamao mximo de la prueba en elementos. Con 2^30 (mil millones) de claves de 32 bits
+// hacen falta 8 GB entre el arreglo y el auxiliar.
+#ifndef BENCH_RADIX_MAX_COUNT
+#define BENCH_RADIX_MAX_COUNT (std::size_t(1) << 26)
+#endif
+
+namespace
+{
+    /// Un registro con una marca de tiempo como clave.
+    struct event
+    {
+        std::int64_t timestamp;
+        std::uint32_t source;
+        std::uint32_t payload;
+    };
+
+    /**
+     * Ordena copias de @a input con @a sort_function, repitiendo hasta sumar al menos
+     * 2^22 elementos ordenados, y retorna los nanosegundos por elemento. Copiar la
+     * entrada no se incluye en el tiempo.
+     */
+    template <typename ValueType, typename Sort>
+    double time_sort(const mySTL::vector<ValueType>& input, mySTL::vector<ValueType>& work, Sort sort_function)
+    {
+        const std::size_t count = input.size();
+        const std::size_t rounds = (count >= (std::size_t(1) << 22)) ? 1 : (std::size_t(1) << 22) / count;
+        double seconds = 0;
+        for (std::size_t round = 0; round < rounds; ++round)
+        {
+            mySTL::copy(input.data(), input.data() + count, work.data());
+            do_not_optimize(work.data());
+            bench_timer timer;
+            sort_function(work.data(), work.data() + count);
+            seconds += timer.seconds();
+            do_not_optimize(work.data());
+        }
+        return seconds * 1e9 / (double(rounds) * double(count));
+    }
+
+    /// Compara sort, radix_sort y radix_sort paralelo con @a count claves aleatorias.
+    template <typename ValueType>
+    void compare_sorts(const char* name, std::size_t count)
+    {
+        std::mt19937_64 generator(7);
+        mySTL::vector<ValueType> input(count);
+        mySTL::vector<ValueType> work(count);
+        for (std::size_t index = 0; index < count; ++index)
+            input[index] = ValueType(generator());
+
+        const double sort_ns = time_sort(input, work,
+            [](ValueType* first, ValueType* last) { mySTL::sort(first, last); });
+        const double radix_ns = time_sort(input, work,
+            [](ValueType* first, ValueType* last) { mySTL::radix_sort(first, last); });
+        const double parallel_ns = time_sort(input, work,
+            [](ValueType* first, ValueType* last) { mySTL::radix_sort(mySTL::execution::par, first, last); });
+
+        std::printf("  %-9s %10zu   %8.2f   %8.2f   %8.2f\n", name, count, sort_ns, radix_ns, parallel_ns);
+    }
+}
+
+int benchRadixSort()
+{
+    std::printf("Ordenar claves aleatorias (ns por elemento):\n");
+    std::printf("  tipo       elementos       sort      radix   radix par\n");
+    for (std::size_t count = std::size_t(1) << 10; count <= BENCH_RADIX_MAX_COUNT; count <<= 4)
+        compare_sorts<std::uint32_t>("uint32_t", count);
+    for (std::size_t count = std::size_t(1) << 10; count <= BENCH_RADIX_MAX_COUNT; count <<= 4)
+        compare_sorts<std::uint64_t>("uint64_t", count);
+    compare_sorts<double>("double", std::size_t(1) << 20);
+
+    // Registros de 16 bytes ordenados por una marca de tiempo de 64 bits.
+    const std::size_t count = std::size_t(1) << 20;
+    std::mt19937_64 generator(7);
+    mySTL::vector<event> input(count);
+    mySTL::vector<event> work(count);
+    for (std::size_t index = 0; index < count; ++index)
+        input[index] = event{ std::int64_t(generator() >> 24), std::uint32_t(index), 0 };
+
+    const double sort_ns = time_sort(input, work, [](event* first, event* last)
+    {
+        mySTL::sort(first, last, [](const event& lhs, const event& rhs) { return lhs.timestamp < rhs.timestamp; });
+    });
+    const double radix_ns = time_sort(input, work, [](event* first, event* last)
+    {
+        mySTL::radix_sort(first, last, [](const event& value) { return value.timestamp; });
+    });
+    std::printf("  registro  %10zu   %8.2f   %8.2f\n", count, sort_ns, radix_ns);
+    std::printf("\n");
+
+    return 0;
+}
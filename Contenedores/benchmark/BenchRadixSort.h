@@ -0,0 +1,13 @@
+#ifndef BENCH_RADIX_SORT_H
+#define BENCH_RADIX_SORT_H
+
+#include "BenchTimer.h"
+#include "../algorithm/my_radix_sort.h"
+#include "../vector/my_vector.h"
+
+#include <cstdint>
+#include <cstdio>
+
+int benchRadixSort();
+
+#endif /* BENCH_RADIX_SORT_H */
@@ -0,0 +1,117 @@
+#include "BenchSearch.h"
+
+namespace
+{
+    /// Bsqueda con un ciclo de un elemento por iteracin, como la de std::find.
+    template <typename ValueType>
+    __attribute__((noinline)) const ValueType* element_find(const ValueType* first, const ValueType* last,
+        ValueType value)
+    {
+        for (; first != last; ++first)
+            if (*first == value)
+                return first;
+        return last;
+    }
+
+    /// Comparacin con un ciclo de un elemento por iteracin, como la de std::mismatch.
+    template <typename ValueType>
+    __attribute__((noinline)) const ValueType* element_mismatch(const ValueType* first1, const ValueType* last1,
+        const ValueType* first2)
+    {
+        for (; first1 != last1 && *first1 == *first2; ++first1, ++first2)
+        {
+        }
+        return first1;
+    }
+
+    /// Retorna los nanosegundos por llamada de @a function, repetida @a rounds veces.
+    template <typename Function>
+    double time_calls(int rounds, Function function)
+    {
+        std::size_t checksum = 0;
+        bench_timer timer;
+        for (int round = 0; round < rounds; ++round)
+        {
+            checksum += function();
+            // Que el compilador no saque la llamada del ciclo.
+            do_not_optimize(checksum);
+        }
+        const double seconds = timer.seconds();
+        do_not_optimize(checksum);
+        return seconds * 1e9 / rounds;
+    }
+
+    /**
+     * Mide find y mismatch en un arreglo de 64 KB cuya nica diferencia est en
+     * distintas posiciones, y count sobre todo el arreglo.
+     */
+    template <typename ValueType>
+    void search_positions(const char* type_name)
+    {
+        const std::size_t count = (std::size_t(1) << 16) / sizeof(ValueType);
+        mySTL::vector<ValueType> haystack(count, ValueType(1));
+        mySTL::vector<ValueType> copy(count, ValueType(1));
+        const ValueType* first = haystack.data();
+        const ValueType* last = first + count;
+
+        std::printf("%s, 64 KB (ns por llamada):\n", type_name);
+        std::printf("   posicion   find: ciclo   std::find   mySTL::find   mismatch: ciclo   mySTL::mismatch\n");
+        const std::size_t positions[] = { 0, 16, 256, 4096, count - 1, count };
+        for (std::size_t position : positions)
+        {
+            if (position < count)
+            {
+                haystack[position] = ValueType(2);
+                copy[position] = ValueType(3);
+            }
+            do_not_optimize(haystack.data());
+            do_not_optimize(copy.data());
+
+            const int rounds = (position < 1024) ? 200000 : 20000;
+            const double element_find_ns = time_calls(rounds, [first, last]()
+                { return std::size_t(element_find(first, last, ValueType(2)) - first); });
+            const double std_find_ns = time_calls(rounds, [first, last]()
+                { return std::size_t(std::find(first, last, ValueType(2)) - first); });
+            const double find_ns = time_calls(rounds, [first, last]()
+                { return std::size_t(mySTL::find(first, last, ValueType(2)) - first); });
+            const ValueType* other = copy.data();
+            const double element_mismatch_ns = time_calls(rounds, [first, last, other]()
+                { return std::size_t(element_mismatch(first, last, other) - first); });
+            const double mismatch_ns = time_calls(rounds, [first, last, other]()
+                { return std::size_t(mySTL::mismatch(first, last, other).first - first); });
+
+            if (position < count)
+                std::printf("  %9zu", position);
+            else
+                std::printf("    ninguna");
+            std::printf("   %11.1f   %9.1f   %11.1f   %15.1f   %15.1f\n", element_find_ns, std_find_ns, find_ns,
+                element_mismatch_ns, mismatch_ns);
+
+            if (position < count)
+            {
+                haystack[position] = ValueType(1);
+                copy[position] = ValueType(1);
+            }
+        }
+
+        // Un tercio de los elementos son iguales al valor contado.
+        for (std::size_t index = 0; index < count; ++index)
+            haystack[index] = ValueType(index % 3);
+        do_not_optimize(haystack.data());
+        const int rounds = 2000;
+        const double std_count_ns = time_calls(rounds, [first, last]()
+            { return std::size_t(std::count(first, last, ValueType(2))); });
+        const double count_ns = time_calls(rounds, [first, last]()
+            { return std::size_t(mySTL::count(first, last, ValueType(2))); });
+        std::printf("  count de todo el arreglo: std::count %.1f, mySTL::count %.1f\n\n", std_count_ns, count_ns);
+    }
+}
+
+int benchSearch()
+{
+    search_positions<std::uint8_t>("uint8_t");
+    search_positions<std::uint32_t>("uint32_t");
+    search_positions<std::uint64_t>("uint64_t");
+
+    return 0;
+}
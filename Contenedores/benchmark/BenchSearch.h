@@ -0,0 +1,14 @@
+#ifndef BENCH_SEARCH_H
+#define BENCH_SEARCH_H
+
+#include "BenchTimer.h"
+#include "../algorithm/my_algorithm.h"
+#include "../vector/my_vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+
+int benchSearch();
+
+#endif /* BENCH_SEARCH_H */
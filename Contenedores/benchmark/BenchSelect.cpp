@@ -0,0 +1,138 @@
+#include "BenchSelect.h"
+
+#include <cmath>
+#include <random>
+
+namespace
+{
+    /// Los percentiles calculados: p50, p99 y p99.9.
+    struct percentiles
+    {
+        std::uint32_t p50;
+        std::uint32_t p99;
+        std::uint32_t p999;
+    };
+
+    /// Retorna la posicin del percentil @a per_mille (en milsimas) en @a count muestras.
+    std::size_t rank(std::size_t count, std::size_t per_mille)
+    {
+        return count * per_mille / 1000;
+    }
+
+    /// Calcula los percentiles ordenando todas las muestras.
+    percentiles by_sort(std::uint32_t* first, std::uint32_t* last)
+    {
+        const std::size_t count = std::size_t(last - first);
+        mySTL::sort(first, last);
+        return { first[rank(count, 500)], first[rank(count, 990)], first[rank(count, 999)] };
+    }
+
+    /**
+     * Calcula los percentiles con nth_element. Cada seleccin deja los mayores a la
+     * derecha, as que la siguiente solo recorre esa parte.
+     */
+    template <typename Select>
+    percentiles by_select(std::uint32_t* first, std::uint32_t* last, Select select)
+    {
+        const std::size_t count = std::size_t(last - first);
+        std::uint32_t* p50 = first + rank(count, 500);
+        std::uint32_t* p99 = first + rank(count, 990);
+        std::uint32_t* p999 = first + rank(count, 999);
+        select(first, p50, last);
+        select(p50 + 1, p99, last);
+        select(p99 + 1, p999, last);
+        return { *p50, *p99, *p999 };
+    }
+
+    /**
+     * Calcula p99 y p99.9 recorriendo las muestras una vez con top_k, como si llegaran
+     * de a una; solo se guarda el 1 % mayor. La mediana necesitara guardar la mitad de
+     * las muestras, as que no se calcula.
+     */
+    percentiles by_top_k(const std::uint32_t* first, const std::uint32_t* last)
+    {
+        const std::size_t count = std::size_t(last - first);
+        mySTL::top_k<std::uint32_t> largest(count - rank(count, 990));
+        largest.push(first, last);
+        const mySTL::vector<std::uint32_t> top = largest.sorted();
+        return { 0, top[top.size() - 1], top[count - 1 - rank(count, 999)] };
+    }
+
+    /// Retorna los milisegundos de aplicar @a function a una copia de @a input.
+    template <typename Function>
+    double time_copy(const mySTL::vector<std::uint32_t>& input, mySTL::vector<std::uint32_t>& work,
+        Function function, percentiles& result)
+    {
+        mySTL::copy(input.data(), input.data() + input.size(), work.data());
+        do_not_optimize(work.data());
+        bench_timer timer;
+        result = function(work.data(), work.data() + work.size());
+        const double milliseconds = timer.seconds() * 1e3;
+        do_not_optimize(work.data());
+        return milliseconds;
+    }
+}
+
+int benchSelect()
+{
+    // Latencias simuladas en microsegundos: log-normal, con una cola larga.
+    const std::size_t count = 10000000;
+    std::mt19937 generator(5);
+    std::lognormal_distribution<double> latency(5.0, 1.0);
+    mySTL::vector<std::uint32_t> input(count);
+    mySTL::vector<std::uint32_t> work(count);
+    for (std::size_t index = 0; index < count; ++index)
+        input[index] = std::uint32_t(latency(generator));
+
+    std::printf("Percentiles p50, p99 y p99.9 de 10^7 latencias (milisegundos):\n");
+    percentiles result;
+    double milliseconds = time_copy(input, work, by_sort, result);
+    std::printf("  mySTL::sort            %8.1f   (%u, %u, %u)\n", milliseconds, result.p50, result.p99, result.p999);
+    milliseconds = time_copy(input, work, [](std::uint32_t* first, std::uint32_t* last)
+        {
+            return by_select(first, last, [](std::uint32_t* begin, std::uint32_t* nth, std::uint32_t* end)
+                { std::nth_element(begin, nth, end); });
+        }, result);
+    std::printf("  std::nth_element       %8.1f   (%u, %u, %u)\n", milliseconds, result.p50, result.p99, result.p999);
+    milliseconds = time_copy(input, work, [](std::uint32_t* first, std::uint32_t* last)
+        {
+            return by_select(first, last, [](std::uint32_t* begin, std::uint32_t* nth, std::uint32_t* end)
+                { mySTL::nth_element(begin, nth, end); });
+        }, result);
+    std::printf("  mySTL::nth_element     %8.1f   (%u, %u, %u)\n", milliseconds, result.p50, result.p99, result.p999);
+    milliseconds = time_copy(input, work, by_top_k, result);
+    std::printf("  mySTL::top_k (1 %%)     %8.1f   (-, %u, %u)\n", milliseconds, result.p99, result.p999);
+    std::printf("\n");
+
+    // partial_sort con k creciente: std (heap select) contra mySTL, que cambia a
+    // nth_element + sort cuando k pasa de un octavo del rango.
+    const std::size_t partial_count = std::size_t(1) << 20;
+    mySTL::vector<std::uint32_t> partial_input(partial_count);
+    mySTL::vector<std::uint32_t> partial_work(partial_count);
+    for (std::size_t index = 0; index < partial_count; ++index)
+        partial_input[index] = std::uint32_t(generator());
+
+    std::printf("partial_sort de 2^20 enteros de 32 bits (milisegundos):\n");
+    std::printf("          k   std::partial_sort   mySTL::partial_sort\n");
+    for (std::size_t k = 16; k <= partial_count; k *= 16)
+    {
+        double times[2];
+        for (int variant = 0; variant < 2; ++variant)
+        {
+            mySTL::copy(partial_input.data(), partial_input.data() + partial_count, partial_work.data());
+            do_not_optimize(partial_work.data());
+            std::uint32_t* first = partial_work.data();
+            bench_timer timer;
+            if (variant == 0)
+                std::partial_sort(first, first + k, first + partial_count);
+            else
+                mySTL::partial_sort(first, first + k, first + partial_count);
+            times[variant] = timer.seconds() * 1e3;
+            do_not_optimize(partial_work.data());
+        }
+        std::printf("  %9zu   %17.2f   %19.2f\n", k, times[0], times[1]);
+    }
+    std::printf("\n");
+
+    return 0;
+}
@@ -0,0 +1,15 @@
+#ifndef BENCH_SELECT_H
+#define BENCH_SELECT_H
+
+#include "BenchTimer.h"
+#include "../algorithm/my_algorithm.h"
+#include "../algorithm/my_sort.h"
+#include "../vector/my_vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+
+int benchSelect();
+
+#endif /* BENCH_SELECT_H */
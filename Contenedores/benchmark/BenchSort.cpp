@@ -0,0 +1,111 @@
+#include "BenchSort.h"
+
+#include <random>
+
+namespace
+{
+    /// Las distribuciones de entrada que se prueban.
+    enum class pattern
+    {
+        random,     // Valores aleatorios.
+        sorted,     // Ya ordenados.
+        reversed,   // Ordenados de forma descendente.
+        few_unique, // Valores aleatorios entre 0 y 15.
+        organ_pipe  // Ascendentes hasta la mitad y descendentes despus.
+    };
+
+    /// Nombres de las distribuciones para imprimir.
+    const char* pattern_names[] = { "aleatorio", "ordenado", "invertido", "pocos distintos", "organo" };
+
+    /// Llena @a values con @a count valores con la distribucin @a kind.
+    void make_input(mySTL::vector<std::uint32_t>& values, std::size_t count, pattern kind)
+    {
+        std::mt19937 generator(42);
+        values.resize(count, 0);
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            switch (kind)
+            {
+            case pattern::random: values[index] = std::uint32_t(generator()); break;
+            case pattern::sorted: values[index] = std::uint32_t(index); break;
+            case pattern::reversed: values[index] = std::uint32_t(count - index); break;
+            case pattern::few_unique: values[index] = std::uint32_t(generator() % 16); break;
+            case pattern::organ_pipe:
+                values[index] = std::uint32_t(index < count / 2 ? index : count - index);
+                break;
+            }
+        }
+    }
+
+    /**
+     * Ordena copias de @a input @a rounds veces con @a sort_function y retorna los
+     * nanosegundos por elemento. Copiar la entrada no se incluye en el tiempo.
+     */
+    template <typename Sort>
+    double time_sort(const mySTL::vector<std::uint32_t>& input, mySTL::vector<std::uint32_t>& work,
+        int rounds, Sort sort_function)
+    {
+        double seconds = 0;
+        for (int round = 0; round < rounds; ++round)
+        {
+            std::copy(input.data(), input.data() + input.size(), work.data());
+            do_not_optimize(work.data());
+            bench_timer timer;
+            sort_function(work.data(), work.data() + work.size());
+            seconds += timer.seconds();
+            do_not_optimize(work.data());
+        }
+        return seconds * 1e9 / (double(rounds) * double(input.size()));
+    }
+
+    /// Igual que time_sort, pero ordena un deque con los mismos valores.
+    template <typename Sort>
+    double time_deque_sort(const mySTL::vector<std::uint32_t>& input, int rounds, Sort sort_function)
+    {
+        double seconds = 0;
+        for (int round = 0; round < rounds; ++round)
+        {
+            mySTL::deque<std::uint32_t> work;
+            for (std::size_t index = 0; index < input.size(); ++index)
+                work.push_back(input[index]);
+            bench_timer timer;
+            sort_function(work.begin(), work.end());
+            seconds += timer.seconds();
+            do_not_optimize(work.front());
+        }
+        return seconds * 1e9 / (double(rounds) * double(input.size()));
+    }
+}
+
+int benchSort()
+{
+    const std::size_t count = std::size_t(1) << 20;
+    const int rounds = 5;
+
+    std::printf("Ordenar 2^20 enteros de 32 bits (ns por elemento):\n");
+    std::printf("  entrada           std::sort   mySTL::sort   std deque   mySTL deque\n");
+
+    mySTL::vector<std::uint32_t> input;
+    mySTL::vector<std::uint32_t> work(count);
+    for (int kind = 0; kind < 5; ++kind)
+    {
+        make_input(input, count, pattern(kind));
+
+        const double std_ns = time_sort(input, work, rounds,
+            [](std::uint32_t* first, std::uint32_t* last) { std::sort(first, last); });
+        const double my_ns = time_sort(input, work, rounds,
+            [](std::uint32_t* first, std::uint32_t* last) { mySTL::sort(first, last); });
+        const double std_deque_ns = time_deque_sort(input, rounds,
+            [](mySTL::my_deque_iterator<std::uint32_t> first, mySTL::my_deque_iterator<std::uint32_t> last)
+            { std::sort(first, last); });
+        const double my_deque_ns = time_deque_sort(input, rounds,
+            [](mySTL::my_deque_iterator<std::uint32_t> first, mySTL::my_deque_iterator<std::uint32_t> last)
+            { mySTL::sort(first, last); });
+
+        std::printf("  %-16s %10.2f   %11.2f   %9.2f   %11.2f\n", pattern_names[kind],
+            std_ns, my_ns, std_deque_ns, my_deque_ns);
+    }
+    std::printf("\n");
+
+    return 0;
+}
@@ -0,0 +1,15 @@
+#ifndef BENCH_SORT_H
+#define BENCH_SORT_H
+
+#include "BenchTimer.h"
+#include "../algorithm/my_sort.h"
+#include "../deque/my_deque.h"
+#include "../vector/my_vector.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+
+int benchSort();
+
+#endif /* BENCH_SORT_H */
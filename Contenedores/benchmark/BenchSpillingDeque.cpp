@@ -0,0 +1,53 @@
+#include "BenchSpillingDeque.h"
+
+namespace
+{
+    /**
+     * Acumula @a count enteros en el contenedor (como durante una falla del
+     * consumidor) y luego los saca todos.
+     *
+     * @return Nanosegundos promedio por elemento, contando la entrada y la salida.
+     */
+    template <typename Container>
+    double fill_and_drain(Container& container, std::size_t count)
+    {
+        long long sum = 0;
+        bench_timer timer;
+
+        for (std::size_t num = 0; num < count; ++num)
+            container.push_back(int(num));
+        while (!container.empty())
+        {
+            sum += container.front();
+            container.pop_front();
+        }
+
+        double seconds = timer.seconds();
+        do_not_optimize(sum);
+        return seconds * 1e9 / double(count);
+    }
+}
+
+int benchSpillingDeque()
+{
+    // 32 millones de enteros: 128 MB de elementos.
+    const std::size_t count = std::size_t(32) << 20;
+
+    std::printf("Acumular y vaciar %zu enteros (128 MB):\n", count);
+    std::printf("  contenedor                  ns/elemento   escritos   leidos   sincronos\n");
+
+    mySTL::deque<int> in_memory;
+    std::printf("  deque en memoria            %11.2f\n", fill_and_drain(in_memory, count));
+
+    for (std::size_t budget = std::size_t(4) << 20; budget <= (std::size_t(64) << 20); budget *= 4)
+    {
+        mySTL::spilling_deque<int> spilling(budget);
+        double time = fill_and_drain(spilling, count);
+        std::printf("  spilling_deque, %2zu MB      %11.2f   %8zu   %6zu   %9zu\n", budget >> 20, time,
+            spilling.spill_stats().spills, spilling.spill_stats().loads,
+            spilling.spill_stats().synchronous_loads);
+    }
+    std::printf("\n");
+
+    return 0;
+}
@@ -0,0 +1,12 @@
+#ifndef BENCH_SPILLING_DEQUE_H
+#define BENCH_SPILLING_DEQUE_H
+
+#include "BenchTimer.h"
+#include "../deque/my_deque.h"
+#include "../spilling_deque/my_spilling_deque.h"
+
+#include <cstdio>
+
+int benchSpillingDeque();
+
+#endif /* BENCH_SPILLING_DEQUE_H */
@@ -0,0 +1,195 @@
+#include "BenchSpscQueue.h"
+
+namespace
+{
+    /// Un deque protegido por un mutex, como se usaba antes para pasar elementos entre hilos.
+    template <typename ValueType>
+    struct locked_deque
+    {
+        std::mutex mutex;
+        mySTL::deque<ValueType> deque;
+
+        bool try_push(const ValueType& value)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            deque.push_back(value);
+            return true;
+        }
+
+        bool try_pop(ValueType& value)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (deque.empty())
+                return false;
+            value = deque.front();
+            deque.pop_front();
+            return true;
+        }
+    };
+
+    /// Adapta spsc_chunked_queue a la interfaz try_push/try_pop.
+    template <typename ValueType>
+    struct chunked_adapter
+    {
+        mySTL::spsc_chunked_queue<ValueType> queue;
+
+        bool try_push(const ValueType& value) { queue.push(value); return true; }
+        bool try_pop(ValueType& value) { return queue.try_pop(value); }
+    };
+
+    /**
+     * Pasa @a item_count enteros de un hilo productor a un hilo consumidor,
+     * un elemento a la vez.
+     *
+     * @return Millones de elementos por segundo.
+     */
+    template <typename Queue>
+    double throughput(Queue& queue, long long item_count)
+    {
+        long long sum = 0;
+        bench_timer timer;
+
+        std::thread consumer([&]()
+        {
+            long long item = 0;
+            for (long long received = 0; received < item_count; )
+            {
+                if (queue.try_pop(item))
+                {
+                    sum += item;
+                    ++received;
+                }
+                else
+                    std::this_thread::yield(); // Cola vaca: ceder el procesador.
+            }
+        });
+
+        for (long long item = 0; item < item_count; )
+        {
+            if (queue.try_push(item))
+                ++item;
+            else
+                std::this_thread::yield(); // Cola llena: ceder el procesador.
+        }
+
+        consumer.join();
+        double seconds = timer.seconds();
+        do_not_optimize(sum);
+        return item_count / seconds / 1e6;
+    }
+
+    /**
+     * Igual que throughput, pero el productor y el consumidor usan push_n/pop_n
+     * con lotes de @a batch elementos.
+     */
+    template <typename Queue>
+    double batch_throughput(Queue& queue, long long item_count, std::size_t batch)
+    {
+        long long sum = 0;
+        bench_timer timer;
+
+        std::thread consumer([&]()
+        {
+            long long items[256];
+            for (long long received = 0; received < item_count; )
+            {
+                std::size_t count = queue.pop_n(items, batch);
+                if (count == 0)
+                    std::this_thread::yield();
+                for (std::size_t index = 0; index < count; ++index)
+                    sum += items[index];
+                received += count;
+            }
+        });
+
+        long long items[256];
+        for (long long item = 0; item < item_count; )
+        {
+            std::size_t count = std::size_t( mySTL::min((long long)(batch), item_count - item) );
+            for (std::size_t index = 0; index < count; ++index)
+                items[index] = item + index;
+
+            // push_n puede aceptar solo una parte del lote si la cola est casi llena.
+            std::size_t pushed = 0;
+            while ((pushed += queue.push_n(items + pushed, count - pushed)) < count)
+                std::this_thread::yield();
+            item += count;
+        }
+
+        consumer.join();
+        double seconds = timer.seconds();
+        do_not_optimize(sum);
+        return item_count / seconds / 1e6;
+    }
+
+    /**
+     * Mide el tiempo de ida y vuelta de un elemento entre dos hilos, usando una
+     * cola para cada direccin.
+     *
+     * @return Nanosegundos promedio por ida y vuelta.
+     */
+    template <typename Queue>
+    double round_trip(Queue& ping, Queue& pong, long long round_count)
+    {
+        bench_timer timer;
+
+        std::thread echo([&]()
+        {
+            long long item = 0;
+            for (long long round = 0; round < round_count; ++round)
+            {
+                while (!ping.try_pop(item)) std::this_thread::yield();
+                while (!pong.try_push(item)) std::this_thread::yield();
+            }
+        });
+
+        long long item = 0;
+        for (long long round = 0; round < round_count; ++round)
+        {
+            while (!ping.try_push(round)) std::this_thread::yield();
+            while (!pong.try_pop(item)) std::this_thread::yield();
+        }
+
+        echo.join();
+        return timer.seconds() * 1e9 / round_count;
+    }
+}
+
+int benchSpscQueue()
+{
+    const long long item_count = 10000000;
+    const long long round_count = 200000;
+
+    std::printf("Paso de %lld enteros entre dos hilos (Melementos/s):\n", item_count);
+
+    {
+        locked_deque<long long> queue;
+        std::printf("  deque + mutex:              %8.2f\n", throughput(queue, item_count));
+    }
+    {
+        mySTL::spsc_queue<long long> queue(4096);
+        std::printf("  spsc_queue:                 %8.2f\n", throughput(queue, item_count));
+    }
+    {
+        chunked_adapter<long long> queue;
+        std::printf("  spsc_chunked_queue:         %8.2f\n", throughput(queue, item_count));
+    }
+    {
+        mySTL::spsc_queue<long long> queue(4096);
+        std::printf("  spsc_queue (lotes de 64):   %8.2f\n", batch_throughput(queue, item_count, 64));
+    }
+
+    std::printf("\nIda y vuelta de un elemento entre dos hilos (ns):\n");
+
+    {
+        locked_deque<long long> ping, pong;
+        std::printf("  deque + mutex:              %8.1f\n", round_trip(ping, pong, round_count));
+    }
+    {
+        mySTL::spsc_queue<long long> ping(64), pong(64);
+        std::printf("  spsc_queue:                 %8.1f\n", round_trip(ping, pong, round_count));
+    }
+    std::printf("\n");
+
+    return 0;
+}
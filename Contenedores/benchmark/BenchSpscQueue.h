@@ -0,0 +1,14 @@
+#ifndef BENCH_SPSC_QUEUE_H
+#define BENCH_SPSC_QUEUE_H
+
+#include "BenchTimer.h"
+#include "../deque/my_deque.h"
+#include "../spsc_queue/my_spsc_queue.h"
+
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+int benchSpscQueue();
+
+#endif /* BENCH_SPSC_QUEUE_H */
@@ -0,0 +1,83 @@
+#include "BenchTieredVector.h"
+
+namespace
+{
+    /**
+     * Inserta @a count enteros, cada uno en una posicin seudoaleatoria.
+     *
+     * @return Nanosegundos promedio por insercin.
+     */
+    template <typename Container>
+    double random_insert(std::size_t count)
+    {
+        Container container;
+        unsigned int seed = 12345;
+        bench_timer timer;
+
+        for (std::size_t num = 0; num < count; ++num)
+        {
+            seed = seed * 1103515245 + 12345;
+            container.insert(container.begin() + (seed >> 8) % (container.size() + 1), int(num));
+        }
+
+        double seconds = timer.seconds();
+        do_not_optimize(container[0]);
+        return seconds * 1e9 / count;
+    }
+
+    /**
+     * Suma los elementos de un contenedor de @a count enteros por ndice,
+     * en orden seudoaleatorio.
+     *
+     * @return Nanosegundos promedio por acceso.
+     */
+    template <typename Container>
+    double random_access(std::size_t count)
+    {
+        Container container;
+        for (std::size_t num = 0; num < count; ++num)
+            container.push_back(int(num));
+
+        unsigned int seed = 12345;
+        long long sum = 0;
+        bench_timer timer;
+
+        for (std::size_t num = 0; num < count; ++num)
+        {
+            seed = seed * 1103515245 + 12345;
+            sum += container[(seed >> 8) % count];
+        }
+
+        double seconds = timer.seconds();
+        do_not_optimize(sum);
+        return seconds * 1e9 / count;
+    }
+}
+
+int benchTieredVector()
+{
+    std::printf("Insercion en posiciones aleatorias (ns por insercion):\n");
+    std::printf("  elementos        vector         deque   tiered_vector\n");
+
+    for (std::size_t count = 10000; count <= 40000; count *= 2)
+    {
+        std::printf("  %9zu   %11.1f   %11.1f   %13.1f\n", count,
+            random_insert<mySTL::vector<int>>(count),
+            random_insert<mySTL::deque<int>>(count),
+            random_insert<mySTL::tiered_vector<int>>(count));
+    }
+
+    std::printf("\nAcceso por indice en orden aleatorio (ns por acceso):\n");
+    std::printf("  elementos        vector         deque   tiered_vector\n");
+
+    for (std::size_t count = 10000; count <= 10000000; count *= 10)
+    {
+        std::printf("  %9zu   %11.2f   %11.2f   %13.2f\n", count,
+            random_access<mySTL::vector<int>>(count),
+            random_access<mySTL::deque<int>>(count),
+            random_access<mySTL::tiered_vector<int>>(count));
+    }
+    std::printf("\n");
+
+    return 0;
+}
@@ -0,0 +1,13 @@
+#ifndef BENCH_TIERED_VECTOR_H
+#define BENCH_TIERED_VECTOR_H
+
+#include "BenchTimer.h"
+#include "../deque/my_deque.h"
+#include "../tiered_vector/my_tiered_vector.h"
+#include "../vector/my_vector.h"
+
+#include <cstdio>
+
+int benchTieredVector();
+
+#endif /* BENCH_TIERED_VECTOR_H */
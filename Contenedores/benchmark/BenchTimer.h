@@ -0,0 +1,63 @@
+#ifndef BENCH_TIMER_H
+#define BENCH_TIMER_H
+
+#include <chrono>
+#include <thread>
+
+/**
+ * @brief Cronmetro simple para las pruebas de rendimiento.
+ */
+struct bench_timer
+{
+    typedef std::chrono::steady_clock clock;
+
+    clock::time_point start_time = clock::now();
+
+    /// Reinicia el cronmetro.
+    void reset() { start_time = clock::now(); }
+
+    /// Retorna los segundos transcurridos desde que se inici el cronmetro.
+    double seconds() const
+    {
+        return std::chrono::duration<double>(clock::now() - start_time).count();
+    }
+};
+
+/**
+ * Evita que el compilador elimine un clculo cuyo resultado no se usa.
+ *
+ * @param value El resultado que se quiere conservar.
+ */
+template <typename ValueType>
+inline void do_not_optimize(const ValueType& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// Retorna la cantidad de ncleos de la mquina, o 1 si no se conoce.
+inline unsigned int bench_max_threads()
+{
+    unsigned int max_threads = std::thread::hardware_concurrency();
+    return (max_threads == 0) ? 1 : max_threads;
+}
+
+/**
+ * Llama a @a function con 1, 2, 4, ... hilos mientras no pasen de @a max_threads y,
+ * si @a max_threads no es potencia de dos, una vez ms con @a max_threads.
+ *
+ * @param max_threads   La cantidad mxima de hilos.
+ * @param function      Funcin que recibe la cantidad de hilos.
+ */
+template <typename Function>
+void for_each_thread_count(unsigned int max_threads, Function function)
+{
+    unsigned int threads = 1;
+    for (; threads <= max_threads; threads *= 2)
+        function(threads);
+
+    // threads / 2 es la mayor potencia de dos medida.
+    if (threads / 2 != max_threads)
+        function(max_threads);
+}
+
+#endif /* BENCH_TIMER_H */
@@ -0,0 +1,128 @@
+#include "BenchWorkStealing.h"
+
+namespace
+{
+    /// Suma los elementos en [first, last), dividiendo el rango en tareas de hasta @a grain elementos.
+    long long parallel_sum(mySTL::thread_pool& pool, const long long* first, const long long* last,
+        std::size_t grain)
+    {
+        std::size_t count = last - first;
+        if (count <= grain)
+        {
+            long long sum = 0;
+            for (; first != last; ++first)
+                sum += *first;
+            return sum;
+        }
+
+        const long long* middle = first + count / 2;
+        long long left_sum = 0;
+        mySTL::task_group group(pool);
+        group.run([&]() { left_sum = parallel_sum(pool, first, middle, grain); });
+        long long right_sum = parallel_sum(pool, middle, last, grain);
+        group.wait();
+
+        return left_sum + right_sum;
+    }
+
+    /// Fibonacci recursivo secuencial.
+    long long serial_fib(int number)
+    {
+        return ( (number < 2) ? number : serial_fib(number - 1) + serial_fib(number - 2) );
+    }
+
+    /// Fibonacci recursivo que crea tareas hasta llegar a @a cutoff.
+    long long parallel_fib(mySTL::thread_pool& pool, int number, int cutoff)
+    {
+        if (number <= cutoff)
+            return serial_fib(number);
+
+        long long first = 0;
+        mySTL::task_group group(pool);
+        group.run([&]() { first = parallel_fib(pool, number - 1, cutoff); });
+        long long second = parallel_fib(pool, number - 2, cutoff);
+        group.wait();
+
+        return first + second;
+    }
+
+    /// Ordenamiento por mezcla paralelo que usa std::sort en rangos de hasta @a grain elementos.
+    void parallel_sort(mySTL::thread_pool& pool, int* first, int* last, int* buffer, std::size_t grain)
+    {
+        std::size_t count = last - first;
+        if (count <= grain)
+        {
+            std::sort(first, last);
+            return;
+        }
+
+        int* middle = first + count / 2;
+        {
+            mySTL::task_group group(pool);
+            group.run([&]() { parallel_sort(pool, first, middle, buffer, grain); });
+            parallel_sort(pool, middle, last, buffer + (middle - first), grain);
+            group.wait();
+        }
+
+        std::merge(first, middle, middle, last, buffer);
+        std::copy(buffer, buffer + count, first);
+    }
+
+    /// Llena @a values con nmeros seudoaleatorios.
+    void fill_random(mySTL::vector<int>& values)
+    {
+        unsigned int seed = 12345;
+        for (std::size_t index = 0; index < values.size(); ++index)
+        {
+            seed = seed * 1103515245 + 12345;
+            values[index] = int(seed >> 1);
+        }
+    }
+}
+
+int benchWorkStealing()
+{
+    const std::size_t sum_count = 20000000;
+    const int fib_number = 32;
+    const std::size_t sort_count = 4000000;
+
+    mySTL::vector<long long> numbers(sum_count);
+    for (std::size_t index = 0; index < sum_count; ++index)
+        numbers[index] = index;
+
+    mySTL::vector<int> unsorted(sort_count);
+    fill_random(unsorted);
+    mySTL::vector<int> values(sort_count);
+    mySTL::vector<int> buffer(sort_count);
+
+    const unsigned int max_threads = bench_max_threads();
+
+    std::printf("thread_pool con work stealing (%u nucleos):\n", max_threads);
+    std::printf("  hilos   suma (ms)   fib(%d) (ms)   sort (ms)\n", fib_number);
+
+    for_each_thread_count(max_threads, [&](unsigned int threads)
+    {
+        mySTL::thread_pool pool(threads);
+
+        bench_timer timer;
+        long long sum = parallel_sum(pool, &numbers[0], &numbers[0] + sum_count, 65536);
+        double sum_ms = timer.seconds() * 1e3;
+        do_not_optimize(sum);
+
+        timer.reset();
+        long long fib = parallel_fib(pool, fib_number, 20);
+        double fib_ms = timer.seconds() * 1e3;
+        do_not_optimize(fib);
+
+        std::copy(&unsorted[0], &unsorted[0] + sort_count, &values[0]);
+        timer.reset();
+        parallel_sort(pool, &values[0], &values[0] + sort_count, &buffer[0], 65536);
+        double sort_ms = timer.seconds() * 1e3;
+        do_not_optimize(values[0]);
+
+        std::printf("  %5u   %9.2f   %12.2f   %9.2f\n", threads, sum_ms, fib_ms, sort_ms);
+    });
+    std::printf("\n");
+
+    return 0;
+}
@@ -0,0 +1,14 @@
+#ifndef BENCH_WORK_STEALING_H
+#define BENCH_WORK_STEALING_H
+
+#include "BenchTimer.h"
+#include "../vector/my_vector.h"
+#include "../work_stealing/my_thread_pool.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+
+int benchWorkStealing();
+
+#endif /* BENCH_WORK_STEALING_H */
@@ -0,0 +1,44 @@
+#include "BenchSpscQueue.h"
+#include "BenchMpmcQueue.h"
+#include "BenchWorkStealing.h"
+#include "BenchTieredVector.h"
+#include "BenchDeque.h"
+#include "BenchMonotonicQueue.h"
+#include "BenchSpillingDeque.h"
+#include "BenchPriorityQueue.h"
+#include "BenchParallel.h"
+#include "BenchCopy.h"
+#include "BenchFill.h"
+#include "BenchCompare.h"
+#include "BenchExecution.h"
+#include "BenchSort.h"
+#include "BenchRadixSort.h"
+#include "BenchMerge.h"
+#include "BenchSelect.h"
+#include "BenchBinarySearch.h"
+#include "BenchSearch.h"
+
+int main()
+{
+    benchSpscQueue();
+    benchMpmcQueue();
+    benchWorkStealing();
+    benchTieredVector();
+    benchDeque();
+    benchMonotonicQueue();
+    benchSpillingDeque();
+    benchPriorityQueue();
+    benchParallel();
+    benchCopy();
+    benchFill();
+    benchCompare();
+    benchExecution();
+    benchSort();
+    benchRadixSort();
+    benchMerge();
+    benchSelect();
+    benchBinarySearch();
+    benchSearch();
+
+    return 0;
+}
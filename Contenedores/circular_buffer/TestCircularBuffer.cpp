@@ -0,0 +1,92 @@
+#include "TestCircularBuffer.h"
+
+/// Imprime un circular_buffer con formato.
+template <typename ValueType>
+void print_circular_buffer(const mySTL::circular_buffer<ValueType>& my_buffer)
+{
+    std::cout << "[ ";
+    for (auto iteration = my_buffer.begin(); iteration != my_buffer.end(); ++iteration)
+        std::cout << *iteration << ( (iteration + 1 != my_buffer.end()) ? ", " : " " );
+    std::cout << "]\n";
+}
+
+int testCircularBuffer()
+{
+    std::cout << "Prueba de push_back con sobrescritura:\n";
+
+    // Ventana deslizante de 5 elementos (arreglo interno de 8).
+    mySTL::circular_buffer<int> buffer1(5);
+
+    for (int num = 1; num <= 10; ++num)
+        buffer1.push_back(num);
+
+    std::cout << "buffer1: ";
+    print_circular_buffer(buffer1); // [ 6, 7, 8, 9, 10 ]
+    std::cout << "Size of buffer1: " << buffer1.size() << '\n'; // 5
+    std::cout << "front: " << buffer1.front() << ", back: " << buffer1.back() << '\n'; // 6, 10
+    std::cout << '\n';
+
+    std::cout << "Prueba de push_back con rechazo:\n";
+
+    mySTL::circular_buffer<int> buffer2(3, mySTL::overflow_policy::reject_when_full);
+
+    for (int num = 1; num <= 5; ++num)
+        std::cout << "push_back(" << num << "): "
+                  << ( buffer2.push_back(num) ? "aceptado" : "rechazado" ) << '\n';
+
+    std::cout << "buffer2: ";
+    print_circular_buffer(buffer2); // [ 1, 2, 3 ]
+    std::cout << '\n';
+
+    std::cout << "Prueba de push_front, pop_front y pop_back:\n";
+
+    buffer2.pop_back();     // [ 1, 2 ]
+    buffer2.push_front(0);  // [ 0, 1, 2 ]
+    buffer2.pop_front();    // [ 1, 2 ]
+    buffer2.push_front(-1); // [ -1, 1, 2 ]
+
+    std::cout << "buffer2: ";
+    print_circular_buffer(buffer2);
+    std::cout << '\n';
+
+    std::cout << "Prueba de iteradores de acceso aleatorio:\n";
+
+    std::cout << "buffer1[2]: " << buffer1[2] << '\n';                  // 8
+    std::cout << "*(begin() + 3): " << *(buffer1.begin() + 3) << '\n';  // 9
+    std::cout << "end() - begin(): " << (buffer1.end() - buffer1.begin()) << '\n'; // 5
+
+    std::cout << "buffer1 invertido: [ ";
+    for (auto iteration = buffer1.rbegin(); iteration != buffer1.rend(); ++iteration)
+        std::cout << *iteration << ' ';
+    std::cout << "]\n\n";
+
+    std::cout << "Prueba de first_segment y second_segment:\n";
+
+    // Los elementos 6, 7 y 8 quedan al final del arreglo interno y 9, 10 al inicio.
+    auto first = buffer1.first_segment();
+    auto second = buffer1.second_segment();
+
+    std::cout << "first_segment: [ ";
+    for (const int* current = first.first; current != first.second; ++current)
+        std::cout << *current << ' ';
+    std::cout << "]\n"; // [ 6 7 8 ]
+
+    std::cout << "second_segment: [ ";
+    for (const int* current = second.first; current != second.second; ++current)
+        std::cout << *current << ' ';
+    std::cout << "]\n\n"; // [ 9 10 ]
+
+    std::cout << "Prueba del metodo at:\n";
+
+    try
+    {
+        buffer1.at(5);
+    }
+    catch (const std::out_of_range& exception)
+    {
+        std::cout << "Excepcion: " << exception.what() << '\n';
+    }
+    std::cout << '\n';
+
+    return 0;
+}
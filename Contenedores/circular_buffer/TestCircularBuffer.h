@@ -0,0 +1,10 @@
+#ifndef TEST_CIRCULAR_BUFFER_H
+#define TEST_CIRCULAR_BUFFER_H
+
+#include "my_circular_buffer.h"
+
+#include <iostream>
+
+int testCircularBuffer();
+
+#endif /* TEST_CIRCULAR_BUFFER_H */
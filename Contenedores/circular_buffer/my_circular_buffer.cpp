@@ -0,0 +1 @@
+#include "my_circular_buffer.h"
\ No newline at end of file
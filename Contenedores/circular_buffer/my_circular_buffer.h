@@ -0,0 +1,596 @@
+#ifndef MY_CIRCULAR_BUFFER_H
+#define MY_CIRCULAR_BUFFER_H
+
+#include "../algorithm/my_algorithm.h"
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace mySTL
+{
+    /**
+     * @brief Indica qu hace el contenedor circular_buffer cuando se
+     * agrega un elemento y ya est lleno.
+     */
+    enum class overflow_policy
+    {
+        overwrite_oldest,   // Se sobrescribe el elemento del extremo opuesto.
+        reject_when_full    // Se rechaza el nuevo elemento.
+    };
+
+    /**
+     * @brief Retorna la menor potencia de dos que es mayor o igual a @a count.
+     *
+     * @param count Un nmero de elementos.
+     * @return Una potencia de dos, de al menos 1.
+     */
+    constexpr inline std::size_t my_next_power_of_two(std::size_t count)
+    {
+        std::size_t result = 1;
+        while (result < count)
+            result <<= 1;
+        return result;
+    }
+
+    /**
+     * @brief circular_buffer::iterator. Recorre los elementos del contenedor
+     * aplicando la mscara de la capacidad a una posicin que solo avanza.
+     *
+     * @tparam ValueType    El tipo de los elementos del contenedor
+     * (const para el iterador constante).
+     */
+    template <typename ValueType>
+    struct my_circular_buffer_iterator
+    {
+        // Identifica este struct como un iterador de acceso aleatorio.
+        typedef std::random_access_iterator_tag iterator_category;
+        // Primer parmetro de plantilla, sin calificador const.
+        typedef std::remove_cv_t<ValueType> value_type;
+        // Tipo entero sin signo.
+        typedef std::size_t     size_type;
+        // Tipo entero con signo.
+        typedef std::ptrdiff_t  difference_type;
+        // Referencia.
+        typedef ValueType&      reference;
+        // Puntero.
+        typedef ValueType*      pointer;
+        // Nombre del struct.
+        typedef my_circular_buffer_iterator self;
+
+        pointer elements;   // Puntero al arreglo interno del contenedor.
+        size_type mask;     // La capacidad del arreglo interno menos uno.
+        size_type position; // Posicin lgica, sin aplicar la mscara.
+
+        /// Constructor por defecto.
+        my_circular_buffer_iterator() noexcept
+            : elements(nullptr)
+            , mask(0)
+            , position(0)
+        {
+        }
+
+        /// Construye un iterador que apunta a la posicin lgica @a position de @a elements.
+        my_circular_buffer_iterator(pointer elements, size_type mask, size_type position) noexcept
+            : elements(elements)
+            , mask(mask)
+            , position(position)
+        {
+        }
+
+        /// Convierte un iterador en un iterador constante.
+        template <typename OtherType,
+                  typename = std::enable_if_t<std::is_same_v<const OtherType, ValueType>>>
+        my_circular_buffer_iterator(const my_circular_buffer_iterator<OtherType>& other) noexcept
+            : elements(other.elements)
+            , mask(other.mask)
+            , position(other.position)
+        {
+        }
+
+        // Sobrecarga de operadores.
+
+        /// Retorna el elemento al que apunta el iterador.
+        reference operator*() const noexcept { return elements[position & mask]; }
+        /// Retorna un puntero al elemento al que apunta el iterador.
+        pointer operator->() const noexcept { return elements + (position & mask); }
+        /// Retorna el elemento en la posicin actual + @a count.
+        reference operator[](difference_type count) const noexcept { return elements[(position + count) & mask]; }
+
+        /// Operador de incremento prefijo.
+        self& operator++() noexcept { ++position; return *this; }
+        /// Operador de incremento postfijo.
+        self operator++(int) noexcept { self temp = *this; ++position; return temp; }
+        /// Operador de disminucin prefijo.
+        self& operator--() noexcept { --position; return *this; }
+        /// Operador de disminucin postfijo.
+        self operator--(int) noexcept { self temp = *this; --position; return temp; }
+
+        /// Operador de suma-asignacin.
+        self& operator+=(difference_type count) noexcept { position += count; return *this; }
+        /// Operador de resta-asignacin.
+        self& operator-=(difference_type count) noexcept { position -= count; return *this; }
+        /// Operador de suma.
+        self operator+(difference_type count) const noexcept { self temp = *this; return (temp += count); }
+        /// Operador de resta.
+        self operator-(difference_type count) const noexcept { self temp = *this; return (temp -= count); }
+
+        /// Distancia entre dos iteradores del mismo contenedor.
+        difference_type operator-(const self& other) const noexcept
+        {
+            // La resta sin signo sigue siendo correcta aunque las posiciones den la vuelta.
+            return difference_type(position - other.position);
+        }
+
+        // Operadores relacionales. Los iteradores deben ser del mismo contenedor.
+
+        bool operator==(const self& other) const noexcept { return (position == other.position); }
+        bool operator!=(const self& other) const noexcept { return !(*this == other); }
+        bool operator<(const self& other) const noexcept { return ((*this - other) < 0); }
+        bool operator>(const self& other) const noexcept { return (other < *this); }
+        bool operator<=(const self& other) const noexcept { return !(other < *this); }
+        bool operator>=(const self& other) const noexcept { return !(*this < other); }
+    };
+
+    /**
+     * @brief Contenedor secuencial de capacidad fija que almacena sus elementos
+     * en un solo arreglo circular.
+     *
+     * El arreglo interno tiene una capacidad que es potencia de dos, de manera que
+     * la posicin de cada elemento se obtiene con una mscara en lugar de una divisin.
+     *
+     * @tparam ValueType El tipo de los elementos que contiene.
+     */
+    template <typename ValueType>
+    class circular_buffer
+    {
+    // Tipos miembro pblicos
+    public:
+        // Primer parmetro de plantilla.
+        typedef ValueType value_type;
+        // Tipo entero sin signo.
+        typedef std::size_t     size_type;
+        // Tipo entero con signo.
+        typedef std::ptrdiff_t  difference_type;
+        // Referencia.
+        typedef value_type& reference;
+        // Referencia constante.
+        typedef const value_type& const_reference;
+        // Puntero.
+        typedef value_type* pointer;
+        // Puntero constante.
+        typedef const value_type* const_pointer;
+        // Iterador.
+        typedef my_circular_buffer_iterator<value_type> iterator;
+        // Iterador constante.
+        typedef my_circular_buffer_iterator<const value_type> const_iterator;
+        // Iterador inverso.
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        // Iterador inverso constante.
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    // Atributos privados
+    private:
+        size_type max_count;        // La cantidad mxima de elementos que acepta el contenedor.
+        size_type mask;             // La capacidad del arreglo interno (potencia de dos) menos uno.
+        size_type head;             // Posicin lgica del primer elemento.
+        size_type tail;             // Posicin lgica siguiente a la del ltimo elemento.
+        overflow_policy policy;     // Qu hacer cuando se agrega un elemento y el contenedor est lleno.
+        value_type* elements;       // Arreglo interno para guardar elementos de tipo ValueType.
+
+    // Mtodos pblicos
+    public:
+        // Constructores y destructor.
+
+        /**
+         * Constructor de capacidad.
+         *
+         * Construye un contenedor vaco que puede almacenar hasta @a capacity elementos.
+         * El arreglo interno se redondea a la siguiente potencia de dos.
+         *
+         * @param capacity  La cantidad mxima de elementos del contenedor.
+         * @param policy    Qu hacer cuando se agrega un elemento y el contenedor est lleno.
+         */
+        explicit circular_buffer(size_type capacity,
+            overflow_policy policy = overflow_policy::overwrite_oldest)
+            : max_count(capacity)
+            , mask(my_next_power_of_two(capacity) - 1)
+            , head(0)
+            , tail(0)
+            , policy(policy)
+            , elements(new value_type[this->mask + 1])
+        {
+        }
+
+        /**
+         * Constructor de copia.
+         *
+         * Construye el contenedor con una copia de cada uno de los elementos de @a other,
+         * en el mismo orden y con la misma capacidad.
+         *
+         * @param other Otro objeto circular_buffer del mismo tipo, para inicializar el contenedor.
+         */
+        circular_buffer(const circular_buffer& other)
+            : max_count(other.max_count)
+            , mask(other.mask)
+            , head(0)
+            , tail(0)
+            , policy(other.policy)
+            , elements(new value_type[this->mask + 1])
+        {
+            // Copiar los elementos de other desde el inicio del arreglo interno.
+            for (const_iterator current = other.begin(); current != other.end(); ++current)
+                this->elements[this->tail++] = *current;
+        }
+
+        /**
+         * Constructor de movimiento.
+         *
+         * Construye un contenedor que adquiere los elementos de @a temp, con semnticas de movimiento.
+         *
+         * @param temp  Otro objeto circular_buffer del mismo tipo, para inicializar el contenedor.
+         */
+        circular_buffer(circular_buffer&& temp)
+            : max_count(temp.max_count)
+            , mask(temp.mask)
+            , head(temp.head)
+            , tail(temp.tail)
+            , policy(temp.policy)
+            , elements(temp.elements)
+        {
+            // Dejar vaco el contenedor temp.
+            temp.max_count = temp.mask = temp.head = temp.tail = 0;
+            temp.elements = nullptr;
+        }
+
+        /**
+         * Destructor.
+         *
+         * Destruye el objeto contenedor.
+         */
+        ~circular_buffer()
+        {
+            delete [] this->elements;
+        }
+
+        // Operador de asignacin.
+
+        /**
+         * Asignacin por copia.
+         *
+         * Reemplaza el contenido del contenedor por una copia del contenido de @a other.
+         *
+         * @param other Otro objeto circular_buffer del mismo tipo.
+         * @return *this.
+         */
+        circular_buffer& operator=(const circular_buffer& other)
+        {
+            auto temp_copy = circular_buffer(other);
+            this->swap(temp_copy);
+            return *this;
+        }
+
+        /**
+         * Asignacin por movimiento.
+         *
+         * Reemplaza el contenido del contenedor al mover dentro de este el contenido de @a temp.
+         *
+         * @param temp  Otro objeto circular_buffer del mismo tipo.
+         * @return *this.
+         */
+        circular_buffer& operator=(circular_buffer&& temp)
+        {
+            this->swap(temp);
+            return *this;
+        }
+
+        // Iteradores.
+
+        /// Retorna un iterador al principio.
+        inline iterator begin() noexcept { return iterator(this->elements, this->mask, this->head); }
+        /// Retorna un iterador al principio.
+        inline const_iterator begin() const noexcept { return const_iterator(this->elements, this->mask, this->head); }
+        /// Retorna un iterador constante al principio.
+        inline const_iterator cbegin() const noexcept { return begin(); }
+
+        /// Retorna un iterador al final.
+        inline iterator end() noexcept { return iterator(this->elements, this->mask, this->tail); }
+        /// Retorna un iterador al final.
+        inline const_iterator end() const noexcept { return const_iterator(this->elements, this->mask, this->tail); }
+        /// Retorna un iterador constante al final.
+        inline const_iterator cend() const noexcept { return end(); }
+
+        /// Retorna un iterador inverso al principio del contenedor invertido.
+        inline reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        /// Retorna un iterador inverso al principio del contenedor invertido.
+        inline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        /// Retorna un iterador inverso constante al principio del contenedor invertido.
+        inline const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+        /// Retorna un iterador inverso al final del contenedor invertido.
+        inline reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        /// Retorna un iterador inverso al final del contenedor invertido.
+        inline const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+        /// Retorna un iterador inverso constante al final del contenedor invertido.
+        inline const_reverse_iterator crend() const noexcept { return rend(); }
+
+        // Capacidad.
+
+        /// Retorna la cantidad de elementos del contenedor.
+        inline size_type size() const noexcept { return (this->tail - this->head); }
+        /// Retorna la cantidad mxima de elementos que puede contener el contenedor.
+        inline size_type capacity() const noexcept { return this->max_count; }
+        /// Verifica si el contenedor est vaco.
+        inline bool empty() const noexcept { return (size() == 0); }
+        /// Verifica si el contenedor est lleno.
+        inline bool full() const noexcept { return (size() == capacity()); }
+
+        // Acceso a elementos.
+
+        /**
+         * Retorna una referencia al elemento en la posicin @a index del contenedor.
+         *
+         * @param index Posicin de un elemento en el contenedor.
+         * @return El elemento en la posicin especificada.
+         */
+        inline reference operator[](size_type index) { return this->elements[(this->head + index) & this->mask]; }
+
+        /**
+         * Retorna una referencia al elemento en la posicin @a index del contenedor.
+         *
+         * @param index Posicin de un elemento en el contenedor.
+         * @return El elemento en la posicin especificada.
+         */
+        inline const_reference operator[](size_type index) const { return this->elements[(this->head + index) & this->mask]; }
+
+        /**
+         * Retorna una referencia al elemento en la posicin @a index del contenedor.
+         *
+         * Este mtodo verifica si @a index est dentro del lmite de elementos vlidos
+         * en el contenedor. Si no lo est, lanza una excepcin.
+         *
+         * @param index Posicin de un elemento en el contenedor.
+         * @throw std::out_of_range
+         * @return El elemento en la posicin especificada.
+         */
+        inline reference at(size_type index)
+        {
+            if (index >= size())
+                throw std::out_of_range("mySTL::circular_buffer::at");
+
+            return (*this)[index];
+        }
+
+        /**
+         * Retorna una referencia al elemento en la posicin @a index del contenedor.
+         *
+         * Este mtodo verifica si @a index est dentro del lmite de elementos vlidos
+         * en el contenedor. Si no lo est, lanza una excepcin.
+         *
+         * @param index Posicin de un elemento en el contenedor.
+         * @throw std::out_of_range
+         * @return El elemento en la posicin especificada.
+         */
+        inline const_reference at(size_type index) const
+        {
+            if (index >= size())
+                throw std::out_of_range("mySTL::circular_buffer::at");
+
+            return (*this)[index];
+        }
+
+        /// Retorna una referencia al primer elemento en el contenedor.
+        inline reference front() { return this->elements[this->head & this->mask]; }
+        /// Retorna una referencia al primer elemento en el contenedor.
+        inline const_reference front() const { return this->elements[this->head & this->mask]; }
+
+        /// Retorna una referencia al ltimo elemento en el contenedor.
+        inline reference back() { return this->elements[(this->tail - 1) & this->mask]; }
+        /// Retorna una referencia al ltimo elemento en el contenedor.
+        inline const_reference back() const { return this->elements[(this->tail - 1) & this->mask]; }
+
+        /**
+         * Retorna el primer tramo contiguo de elementos en el arreglo interno:
+         * desde el primer elemento hasta el ltimo o hasta el final del arreglo.
+         *
+         * Junto con second_segment, describe todo el contenido del contenedor
+         * sin copiarlo (por ejemplo, para escribirlo con writev).
+         *
+         * @return Un par de punteros [primero, ltimo) que delimitan el tramo.
+         */
+        std::pair<const_pointer, const_pointer> first_segment() const noexcept
+        {
+            const_pointer first = this->elements + (this->head & this->mask);
+            // El tramo no puede sobrepasar el final del arreglo interno.
+            size_type count = mySTL::min(size(), (this->mask + 1) - (this->head & this->mask));
+            return std::make_pair(first, first + count);
+        }
+
+        /**
+         * Retorna el segundo tramo contiguo de elementos en el arreglo interno:
+         * los elementos que dieron la vuelta al inicio del arreglo. Si no hay,
+         * el tramo est vaco.
+         *
+         * @return Un par de punteros [primero, ltimo) que delimitan el tramo.
+         */
+        std::pair<const_pointer, const_pointer> second_segment() const noexcept
+        {
+            std::pair<const_pointer, const_pointer> first = first_segment();
+            size_type count = size() - size_type(first.second - first.first);
+            return std::make_pair(this->elements, this->elements + count);
+        }
+
+        // Modificadores.
+
+        /**
+         * Agrega un nuevo elemento al final del contenedor.
+         *
+         * Si el contenedor est lleno, se sobrescribe el primer elemento o se rechaza
+         * el nuevo elemento, segn la poltica del contenedor.
+         *
+         * @param value El valor del elemento por agregar al contenedor.
+         * @return TRUE si el elemento se agreg; FALSE si fue rechazado.
+         */
+        bool push_back(const value_type& value)
+        {
+            return this->emplace_back(value);
+        }
+
+        /**
+         * Agrega un nuevo elemento al final del contenedor.
+         *
+         * @param value El valor del elemento por agregar al contenedor.
+         * @return TRUE si el elemento se agreg; FALSE si fue rechazado.
+         */
+        bool push_back(value_type&& value)
+        {
+            return this->emplace_back(std::forward<value_type>(value));
+        }
+
+        /**
+         * Construye e inserta un elemento al final del contenedor.
+         *
+         * @param args  Argumentos para construir el nuevo elemento.
+         * @return TRUE si el elemento se agreg; FALSE si fue rechazado.
+         */
+        template <typename... Args>
+        bool emplace_back(Args&&... args)
+        {
+            // Si el contenedor est lleno
+            if (full())
+            {
+                // Rechazar el elemento, o descartar el primero para hacerle espacio.
+                if (this->policy == overflow_policy::reject_when_full || capacity() == 0)
+                    return false;
+                ++this->head;
+            }
+
+            // Construir el nuevo elemento despus del ltimo.
+            this->elements[this->tail & this->mask] = value_type(std::forward<Args>(args)...);
+            ++this->tail;
+            return true;
+        }
+
+        /**
+         * Agrega un nuevo elemento al inicio del contenedor.
+         *
+         * Si el contenedor est lleno, se sobrescribe el ltimo elemento o se rechaza
+         * el nuevo elemento, segn la poltica del contenedor.
+         *
+         * @param value El valor del elemento por agregar al contenedor.
+         * @return TRUE si el elemento se agreg; FALSE si fue rechazado.
+         */
+        bool push_front(const value_type& value)
+        {
+            return this->emplace_front(value);
+        }
+
+        /**
+         * Agrega un nuevo elemento al inicio del contenedor.
+         *
+         * @param value El valor del elemento por agregar al contenedor.
+         * @return TRUE si el elemento se agreg; FALSE si fue rechazado.
+         */
+        bool push_front(value_type&& value)
+        {
+            return this->emplace_front(std::forward<value_type>(value));
+        }
+
+        /**
+         * Construye e inserta un elemento al principio del contenedor.
+         *
+         * @param args  Argumentos para construir el nuevo elemento.
+         * @return TRUE si el elemento se agreg; FALSE si fue rechazado.
+         */
+        template <typename... Args>
+        bool emplace_front(Args&&... args)
+        {
+            if (full())
+            {
+                if (this->policy == overflow_policy::reject_when_full || capacity() == 0)
+                    return false;
+                --this->tail;
+            }
+
+            // Construir el nuevo elemento antes del primero.
+            --this->head;
+            this->elements[this->head & this->mask] = value_type(std::forward<Args>(args)...);
+            return true;
+        }
+
+        /**
+         * Elimina el primer elemento del contenedor y reduce su tamao.
+         */
+        void pop_front()
+        {
+            ++this->head;
+        }
+
+        /**
+         * Elimina el ltimo elemento del contenedor y reduce su tamao.
+         */
+        void pop_back()
+        {
+            --this->tail;
+        }
+
+        /**
+         * Intercambia el contenido de este objeto por el contenido de @a other.
+         *
+         * @param other Otro objeto circular_buffer del mismo tipo, para intercambiar sus elementos.
+         */
+        void swap(circular_buffer& other)
+        {
+            using std::swap; // Funcin swap de la biblioteca estndar.
+            swap(this->max_count, other.max_count);
+            swap(this->mask, other.mask);
+            swap(this->head, other.head);
+            swap(this->tail, other.tail);
+            swap(this->policy, other.policy);
+            swap(this->elements, other.elements);
+        }
+
+        /**
+         * Elimina todos los elementos del contenedor.
+         */
+        void clear() noexcept
+        {
+            this->head = this->tail = 0;
+        }
+
+    };
+
+    // Funciones no miembros.
+
+    // Operadores relacionales
+
+    template <typename ValueType>
+    inline bool operator==(const circular_buffer<ValueType>& lhs, const circular_buffer<ValueType>& rhs)
+    {
+        return ( ( lhs.size() == rhs.size() ) && ( mySTL::equal(lhs.begin(), lhs.end(), rhs.begin()) ) );
+    }
+
+    template <typename ValueType>
+    inline bool operator!=(const circular_buffer<ValueType>& lhs, const circular_buffer<ValueType>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    // Funcin swap
+
+    /**
+    * Intercambia el contenido de @a buffer_one por el de @a buffer_two.
+    *
+    * @param buffer_one, buffer_two Contenedores circular_buffer del mismo tipo.
+    */
+    template <typename ValueType>
+    inline void swap(circular_buffer<ValueType>& buffer_one, circular_buffer<ValueType>& buffer_two)
+    {
+        buffer_one.swap(buffer_two);
+    }
+
+}
+
+#endif /* MY_CIRCULAR_BUFFER_H */
@@ -162,6 +162,137 @@ int testDeque()
 	print_deque(deque15);
 	std::cout << '\n';
 
+	std::cout << "Prueba de los metodos append_range y prepend_range:\n";
+
+	mySTL::deque<int> deque17{ 4, 5 };
+	int more_ints[] = { 6, 7, 8 };
+
+	deque17.append_range(more_ints, more_ints + 3);	// [ 4, 5, 6, 7, 8 ]
+	deque17.prepend_range({ 1, 2, 3 });				// [ 1, 2, 3, 4, 5, 6, 7, 8 ]
+
+	std::cout << "deque17: ";
+	print_deque(deque17);
+
+	// Suficientes elementos para ocupar varios fragmentos de memoria.
+	mySTL::deque<int> deque18(1000, 1);
+	deque17.append_range(deque18.begin(), deque18.end());
+	deque17.prepend_range(deque18.begin(), deque18.end());
+
+	std::cout << "Size of deque17: " << int( deque17.size() ) << '\n'; // 2008
+	std::cout << "deque17[1003]: " << deque17[1003] << '\n'; // 4
+	std::cout << '\n';
+
+	std::cout << "Prueba de los metodos front_segment, pop_front_n y drain_front:\n";
+
+	// Los primeros elementos del primer fragmento de memoria, procesados en su lugar.
+	std::pair<int*, int*> segment = deque17.front_segment();
+	std::cout << "front_segment: [ ";
+	for (int* current = segment.first; current != segment.first + 3; ++current)
+		std::cout << *current << ' ';
+	std::cout << "... ] (" << int( segment.second - segment.first ) << " elementos)\n";
+
+	// Descartar los 1000 elementos agregados al inicio.
+	deque17.pop_front_n(1000);
+
+	int drained[10];
+	deque17.pop_front_n(3, drained);			// 1, 2, 3
+	deque17.drain_front(drained + 3, 5);		// 4, 5, 6, 7, 8
+
+	std::cout << "drained: [ ";
+	for (unsigned index = 0; index < 8; ++index)
+		std::cout << drained[index] << ( (index < 7) ? ", " : " ]\n" );
+
+	std::cout << "Size of deque17: " << int( deque17.size() ) << '\n'; // 1000
+	int big_buffer[1000];
+	std::cout << "Drained: " << int( deque17.drain_front(big_buffer, 10000) ) << '\n'; // 1000
+	std::cout << "Size of deque17: " << int( deque17.size() ) << '\n'; // 0
+	std::cout << '\n';
+
+	std::cout << "Prueba de los metodos reserve y shrink_to_fit:\n";
+
+	mySTL::deque<int> deque19{ 1, 2, 3 };
+	// Reservar fragmentos para 1000 elementos en cada extremo.
+	deque19.reserve(1000, 1000);
+	int* first_element = &deque19[0];
+
+	for (int num = 4; num <= 1000; ++num)
+		deque19.push_back(num);
+	for (int num = 0; num > -1000; --num)
+		deque19.push_front(num);
+
+	std::cout << "Size of deque19: " << int( deque19.size() ) << '\n'; // 2000
+	std::cout << "front: " << deque19.front() << ", back: " << deque19.back() << '\n'; // -999, 1000
+
+	// Los elementos no se mueven al liberar la memoria sobrante.
+	deque19.erase(deque19.begin(), deque19.begin() + 1000);
+	deque19.shrink_to_fit();
+	std::cout << "deque19[1]: " << deque19[1] << '\n'; // 2
+	std::cout << "Mismo lugar: " << ( (&deque19[1] == first_element + 1) ? "si" : "no" ) << '\n'; // si
+	std::cout << '\n';
+
+	std::cout << "Prueba del metodo map_stats:\n";
+
+	// Un deque usado como cola FIFO avanza hacia el final del mapa.
+	mySTL::deque<int> fifo(100, 0);
+	for (int num = 0; num < 100000; ++num)
+	{
+		fifo.push_back(num);
+		fifo.pop_front();
+	}
+
+	std::cout << "fifo.front(): " << fifo.front() << '\n'; // 99900
+	std::cout << "Desplazamientos del mapa: " << int( fifo.map_stats().recenters ) << '\n'; // 130
+	std::cout << "Reasignaciones del mapa: " << int( fifo.map_stats().reallocations ) << '\n'; // 0
+	std::cout << '\n';
+
+	std::cout << "Prueba del metodo allocated_nodes:\n";
+
+	// Despues de reserve, la cola FIFO no acumula fragmentos vacios al inicio.
+	mySTL::deque<int> reserved_fifo(100, 0);
+	reserved_fifo.reserve(1000, 0);
+	std::size_t nodes_before = reserved_fifo.allocated_nodes();
+	for (int num = 0; num < 100000; ++num)
+	{
+		reserved_fifo.push_back(num);
+		reserved_fifo.pop_front();
+	}
+
+	std::cout << "reserved_fifo.front(): " << reserved_fifo.front() << '\n'; // 99900
+	std::cout << "Fragmentos estables: " << ( (reserved_fifo.allocated_nodes() <= nodes_before + 1) ? "si" : "no" ) << '\n'; // si
+	std::cout << '\n';
+
+	std::cout << "Prueba del metodo clear:\n";
+
+	mySTL::deque<std::string> deque20;
+	for (int num = 0; num < 500; ++num)
+		deque20.push_back("cadena " + std::to_string(num));
+
+	// Vaciar y volver a llenar varias veces, como un bufer por cuadro.
+	for (int cycle = 0; cycle < 3; ++cycle)
+	{
+		deque20.clear();
+		deque20.push_back("atras");
+		deque20.push_front("adelante");
+	}
+
+	std::cout << "Size of deque20: " << int( deque20.size() ) << '\n'; // 2
+	std::cout << "deque20: ";
+	print_deque(deque20); // [ adelante, atras ]
+	std::cout << '\n';
+
+	std::cout << "Prueba de insert y erase con cadenas:\n";
+
+	mySTL::deque<std::string> deque21{ "a", "b", "c", "d", "e", "f" };
+	// Los elementos se desplazan moviendolos, sin copiar las cadenas.
+	deque21.insert(deque21.begin() + 4, "x");	// [ a, b, c, d, x, e, f ]
+	deque21.emplace(deque21.begin() + 1, 2, 'y');	// [ a, yy, b, c, d, x, e, f ]
+	deque21.erase(deque21.begin() + 6);				// [ a, yy, b, c, d, x, f ]
+	deque21.erase(deque21.begin() + 2);				// [ a, yy, c, d, x, f ]
+
+	std::cout << "deque21: ";
+	print_deque(deque21); // [ a, yy, c, d, x, f ]
+	std::cout << '\n';
+
 	std::cout << "-----Alerta de SPAM en la pantalla-----\n\n";
 
 	std::cout << "Prueba de los metodos insert:\n";
@@ -221,6 +352,96 @@ int testDeque()
 	std::cout << "deque16: ";
 	print_deque(deque16);
 
+	std::cout << '\n';
+	std::cout << "Prueba de sort:\n";
+
+	// 1000 elementos repartidos en varios fragmentos de memoria.
+	mySTL::deque<int> deque22;
+	for (int num = 0; num < 1000; ++num)
+		deque22.push_front((num * 37) % 1000);
+
+	mySTL::sort(deque22.begin(), deque22.end());
+	bool sorted = true;
+	for (int index = 0; index < 1000; ++index)
+		sorted = sorted && (deque22[index] == index);
+	std::cout << "deque22 ordenado: " << (sorted ? "si" : "no") << '\n'; // si
+
+	mySTL::sort(deque22.begin(), deque22.end(), std::greater<int>());
+	std::cout << "deque22 descendente: " << deque22.front() << ", " << deque22[1] << ", ..., "
+		<< deque22.back() << '\n'; // 999, 998, ..., 0
+
+	// Ordenar por decenas: los elementos con la misma decena conservan su orden.
+	mySTL::deque<int> deque23;
+	for (int num : { 31, 12, 35, 17, 30, 11 })
+		deque23.push_back(num);
+	mySTL::stable_sort(deque23.begin(), deque23.end(), [](int lhs, int rhs) { return lhs / 10 < rhs / 10; });
+	std::cout << "deque23: ";
+	print_deque(deque23); // [ 12, 17, 11, 31, 35, 30 ]
+
+	// Mezclar tres secuencias ordenadas.
+	mySTL::deque<int> deque24;
+	const int runs[3][3] = { { 1, 4, 7 }, { 2, 5, 8 }, { 3, 6, 9 } };
+	const std::pair<const int*, const int*> ranges[3] = { { runs[0], runs[0] + 3 },
+		{ runs[1], runs[1] + 3 }, { runs[2], runs[2] + 3 } };
+	mySTL::multiway_merge(ranges, ranges + 3, std::back_inserter(deque24));
+	std::cout << "deque24: ";
+	print_deque(deque24); // [ 1, 2, 3, 4, 5, 6, 7, 8, 9 ]
+
+	std::cout << "Prueba de seleccion:\n";
+
+	// La mediana de 1000 elementos sin ordenar todo el deque.
+	mySTL::deque<int> deque25;
+	for (int num = 0; num < 1000; ++num)
+		deque25.push_back((num * 37) % 1000);
+	mySTL::nth_element(deque25.begin(), deque25.begin() + 500, deque25.end());
+	std::cout << "deque25 mediana: " << deque25[500] << '\n'; // 500
+
+	mySTL::partial_sort(deque25.begin(), deque25.begin() + 3, deque25.end());
+	std::cout << "deque25 tres menores: " << deque25[0] << ", " << deque25[1] << ", " << deque25[2]
+		<< '\n'; // 0, 1, 2
+
+	// Los tres mayores de una secuencia que llega de a uno.
+	mySTL::top_k<int> largest(3);
+	for (int num : { 5, 42, 17, 8, 99, 23, 61 })
+		largest.push(num);
+	const mySTL::vector<int> top = largest.sorted();
+	std::cout << "top 3: " << top[0] << ", " << top[1] << ", " << top[2] << '\n'; // 99, 61, 42
+
+	std::cout << "Prueba de find, count y mismatch:\n";
+
+	// Un arreglo contiguo de bytes: se revisan varios elementos a la vez.
+	mySTL::vector<std::uint8_t> bytes(100, 7);
+	bytes[64] = 9;
+	bytes[90] = 9;
+	std::cout << "Primer 9 en: " << (mySTL::find(bytes.begin(), bytes.end(), 9) - bytes.begin()) << '\n'; // 64
+	std::cout << "Cantidad de 9: " << mySTL::count(bytes.begin(), bytes.end(), 9) << '\n'; // 2
+	std::cout << "Cantidad de 300: " << mySTL::count(bytes.begin(), bytes.end(), 300) << '\n'; // 0
+
+	// Tipos de un byte con y sin signo: se comparan con las promociones de ==, igual que
+	// std::find. '\xff' es -1 si char tiene signo, y ningn uint8_t es -1.
+	bytes[40] = 0xFF;
+	std::cout << "Busca '\\xff' en uint8_t: "
+		<< (mySTL::find(bytes.begin(), bytes.end(), '\xff') == std::find(bytes.begin(), bytes.end(), '\xff')
+			? "igual que std" : "distinto de std") << '\n'; // igual que std
+	std::cout << "Cantidad de int8_t(-128) en uint8_t: "
+		<< mySTL::count(bytes.begin(), bytes.end(), std::int8_t(-128)) << '\n'; // 0
+	std::cout << "Cantidad de uint8_t(255) en uint8_t: "
+		<< mySTL::count(bytes.begin(), bytes.end(), std::uint8_t(255)) << '\n'; // 1
+	mySTL::array<std::int8_t, 4> signed_bytes = { 1, -1, 2, -1 };
+	std::cout << "Cantidad de uint8_t(255) en int8_t: "
+		<< mySTL::count(signed_bytes.begin(), signed_bytes.end(), std::uint8_t(255)) << '\n'; // 0
+	std::cout << "Cantidad de -1 en int8_t: "
+		<< mySTL::count(signed_bytes.begin(), signed_bytes.end(), -1) << '\n'; // 2
+
+	mySTL::array<std::uint32_t, 6> words1 = { 1, 2, 3, 4, 5, 6 };
+	mySTL::array<std::uint32_t, 6> words2 = { 1, 2, 3, 0, 5, 6 };
+	auto difference = mySTL::mismatch(words1.begin(), words1.end(), words2.begin());
+	std::cout << "Primera diferencia en: " << (difference.first - words1.begin()) << " ("
+		<< *difference.first << " y " << *difference.second << ")\n"; // 3 (4 y 0)
+
+	// Un deque usa el ciclo de un elemento por iteracin.
+	std::cout << "Cantidad de 500 en deque25: " << mySTL::count(deque25.begin(), deque25.end(), 500) << '\n'; // 1
+
 	std::cout << '\n';
 	std::cout << "-----Fin del SPAM, gracias por su atencion. xd-----\n\n";
 
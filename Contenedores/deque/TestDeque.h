@@ -2,9 +2,16 @@
 #define TEST_DEQUE_H
 
 #include "my_deque.h"
+#include "../algorithm/my_sort.h"
+#include "../algorithm/my_merge.h"
+#include "../array/my_array.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
 #include <cstdio>
+#include <string>
 
 int testDeque();
 
@@ -5,6 +5,7 @@
 
 #include <cmath>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <stdexcept>
 #include <type_traits>
@@ -349,6 +350,14 @@ namespace mySTL
         // Iterador inverso constante.
         typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 
+        /// Contadores del mantenimiento del arreglo de punteros (ver reallocate_map).
+        struct map_statistics
+        {
+            size_type recenters = 0;        // Veces que se desplazaron los nodos dentro del mapa.
+            size_type reallocations = 0;    // Veces que se asign un mapa ms grande.
+            size_type moved_nodes = 0;      // Total de nodos copiados por ambas operaciones.
+        };
+
     // Tipos miembro privados
     private:
         // Puntero a punteros.
@@ -360,6 +369,7 @@ namespace mySTL
         size_type map_size;	// El nmero de punteros a los que apunta el mapa. Esta cantidad es de al menos 8.
         iterator start;		// Iterador que apunta al primer elemento del contenedor.
         iterator finish;	// Iterador que apunta al elemento siguiente al ltimo del contenedor.
+        map_statistics statistics;	// Contadores de reasignaciones del mapa.
 
     // Mtodos pblicos
     public:
@@ -375,6 +385,7 @@ namespace mySTL
             , map_size(0)
             , start()
             , finish()
+            , statistics()
         {
             // Inicializar arreglo de nodos sin elementos.
             this->create_map_and_nodes(0);
@@ -392,6 +403,7 @@ namespace mySTL
             , map_size(0)
             , start()
             , finish()
+            , statistics()
         {
             // Inicializar arreglo de nodos con count elementos.
             this->create_map_and_nodes(count);
@@ -410,6 +422,7 @@ namespace mySTL
             , map_size(0)
             , start()
             , finish()
+            , statistics()
         {
             // Inicializar arreglo de nodos con count elementos.
             this->create_map_and_nodes(count);
@@ -440,6 +453,7 @@ namespace mySTL
             , map_size(0)
             , start()
             , finish()
+            , statistics()
         {
             // El nmero de elementos es la distancia entre los iteradores.
             size_type count = std::distance(first, last);
@@ -463,6 +477,7 @@ namespace mySTL
             , map_size(0)
             , start()
             , finish()
+            , statistics()
         {
             // Inicializar arreglo de nodos con el nmero de elementos de other.
             this->create_map_and_nodes( other.size() );
@@ -485,11 +500,13 @@ namespace mySTL
             , map_size(temp.map_size)
             , start(temp.start)
             , finish(temp.finish)
+            , statistics(temp.statistics)
         {
             // Dejar vaco el contenedor temp.
             temp.map = nullptr;
             temp.start = temp.finish = nullptr;
             temp.map_size = 0;
+            temp.statistics = map_statistics();
         }
 
         deque(std::initializer_list<value_type> init_list)
@@ -497,6 +514,7 @@ namespace mySTL
             , map_size(0)
             , start()
             , finish()
+            , statistics()
         {
             // El nmero de elementos es el tamao de init_list.
             size_type count = init_list.size();
@@ -695,30 +713,79 @@ namespace mySTL
         /**
          * Solicita reducir la capacidad del contenedor para encajar
          * con el nmero de elementos.
+         *
+         * Destruye los fragmentos de memoria reservados antes del primer fragmento
+         * y despus del ltimo, y reasigna solo el mapa si le sobran nodos. Los
+         * elementos no se copian ni se mueven.
          */
         void shrink_to_fit()
         {
-            // Calcular el espacio libre para nuevos elementos
-            // al inicio del contenedor.
-            difference_type front_capacity = (this->start.current
-                                            - this->start.first);
-            // Calcular el espacio libre para nuevos elementos
-            // al final del contenedor.
-            difference_type back_capacity = (this->finish.last
-                                            - this->finish.current);
-
-            // Si hay mucho ms espacio libre de lo necesario
-            if ( (front_capacity > 0)
-                && (front_capacity + back_capacity >= buffer_size()) )
+            // Destruir los fragmentos de memoria reservados fuera de [start, finish].
+            for (map_pointer current = this->map; current < this->start.node; ++current)
+                this->deallocate_node(current);
+            for (map_pointer current = this->finish.node + 1;
+                 current < this->map + this->map_size; ++current)
+                this->deallocate_node(current);
+
+            // Calcular el tamao de mapa necesario igual que al construir el contenedor.
+            size_type num_of_nodes = this->finish.node - this->start.node + 1;
+            size_type new_map_size = mySTL::max(size_type(8), num_of_nodes + 2);
+
+            // Si al mapa le sobran nodos
+            if (new_map_size < this->map_size)
             {
-                // Al crear un nuevo contenedor con el mismo contenido, 
-                // se crea con la capacidad adicional necesaria.
-                auto new_deque = deque(this->begin(), this->end());
-                // Intercambiar con el contenedor actual.
-                this->swap(new_deque);
+                // Crear un mapa ms pequeo con los mismos nodos, centrados.
+                map_pointer new_map = new pointer[new_map_size]();
+                map_pointer new_start_node = new_map + (new_map_size - num_of_nodes) / 2;
+                mySTL::copy(this->start.node, this->finish.node + 1, new_start_node);
+
+                delete [] this->map; // Destruir mapa actual.
+                this->map = new_map;
+                this->map_size = new_map_size;
+
+                // Los fragmentos no cambian, as que current sigue siendo vlido.
+                this->start.set_node(new_start_node);
+                this->finish.set_node(new_start_node + num_of_nodes - 1);
             }
         }
 
+        /**
+         * Reserva fragmentos de memoria para que se puedan agregar @a front_count
+         * elementos al inicio y @a back_count elementos al final sin asignar memoria.
+         *
+         * Los fragmentos reservados se conservan hasta que se usan o hasta que se
+         * llama a shrink_to_fit. Al eliminar elementos, cada extremo conserva a lo
+         * ms max_spare_nodes() fragmentos vacos; los dems se destruyen.
+         *
+         * @param front_count   El nmero de elementos que se van a agregar al inicio.
+         * @param back_count    El nmero de elementos que se van a agregar al final.
+         */
+        void reserve(size_type front_count, size_type back_count)
+        {
+            // Espacios disponibles en el primer y el ltimo fragmento de memoria.
+            size_type front_available = this->start.current - this->start.first;
+            size_type back_available = (this->finish.last - this->finish.current) - 1;
+
+            if (front_count > front_available)
+                this->create_new_nodes_at_front(front_count - front_available);
+            if (back_count > back_available)
+                this->create_new_nodes_at_back(back_count - back_available);
+        }
+
+        /// Retorna los contadores de reasignaciones del arreglo de punteros.
+        inline const map_statistics& map_stats() const noexcept { return this->statistics; }
+
+        /// Retorna el nmero de fragmentos de memoria asignados, incluidos los reservados.
+        size_type allocated_nodes() const noexcept
+        {
+            size_type count = 0;
+            for (map_pointer current = this->map;
+                 current < this->map + this->map_size; ++current)
+                if (*current != nullptr)
+                    ++count;
+            return count;
+        }
+
         // Acceso a elementos.
 
         /**
@@ -783,6 +850,41 @@ namespace mySTL
         /// Retorna una referencia al ltimo elemento en el contenedor.
         inline const_reference back() const { return *(end() - 1); }
 
+        /**
+         * Retorna el tramo contiguo de elementos que empieza en el primer elemento
+         * del contenedor y termina al final del primer fragmento de memoria
+         * (o en el ltimo elemento, si est en ese mismo fragmento).
+         *
+         * Permite procesar los elementos del primer fragmento en su lugar antes de
+         * descartarlos con pop_front_n.
+         *
+         * @return Un par de punteros [primero, ltimo) que delimitan el tramo.
+         */
+        std::pair<pointer, pointer> front_segment() noexcept
+        {
+            // Si el primer y el ltimo elemento estn en el mismo fragmento,
+            // el tramo termina en el final de la secuencia.
+            if (this->start.node == this->finish.node)
+                return std::make_pair(this->start.current, this->finish.current);
+
+            return std::make_pair(this->start.current, this->start.last);
+        }
+
+        /**
+         * Retorna el tramo contiguo de elementos que empieza en el primer elemento
+         * del contenedor y termina al final del primer fragmento de memoria
+         * (o en el ltimo elemento, si est en ese mismo fragmento).
+         *
+         * @return Un par de punteros [primero, ltimo) que delimitan el tramo.
+         */
+        std::pair<const_pointer, const_pointer> front_segment() const noexcept
+        {
+            if (this->start.node == this->finish.node)
+                return std::make_pair(this->start.current, this->finish.current);
+
+            return std::make_pair(this->start.current, this->start.last);
+        }
+
         // Modificadores.
 
         /**
@@ -829,8 +931,9 @@ namespace mySTL
                 // Reservar espacio al final del mapa
                 this->reserve_map_at_back();
                 // Crear un nuevo nodo despus del ltimo
-                // e inicializarlo con un nuevo fragmento/buffer.
-                *(this->finish.node + 1) = new value_type[ buffer_size() ];
+                // e inicializarlo con un nuevo fragmento/buffer,
+                // si no tiene uno reservado.
+                this->allocate_node(this->finish.node + 1);
                 // Construir el nuevo elemento en la ltima posicin
                 // del ltimo fragmento viejo.
                 *this->finish.current = value_type(std::forward<Args>(args)...);
@@ -884,8 +987,9 @@ namespace mySTL
                 // Reservar espacio al inicio del mapa
                 this->reserve_map_at_front();
                 // Crear un nuevo nodo antes del primero
-                // e inicializarlo con un nuevo fragmento/buffer.
-                *(this->start.node - 1) = new value_type[ buffer_size() ];
+                // e inicializarlo con un nuevo fragmento/buffer,
+                // si no tiene uno reservado.
+                this->allocate_node(this->start.node - 1);
                 // Reajustar el iterador start para que apunte al nuevo primer nodo.
                 this->start.set_node(this->start.node - 1);
                 this->start.current = this->start.last - 1;
@@ -895,6 +999,98 @@ namespace mySTL
             }
         }
 
+        /**
+         * Agrega los elementos en el rango [@a first, @a last) al final del contenedor.
+         *
+         * Si el rango permite calcular su tamao de antemano, se reservan todos los
+         * fragmentos de memoria necesarios de una sola vez y los elementos se copian
+         * fragmento por fragmento.
+         *
+         * @param first, last   Iteradores a las posiciones inicial y final en un rango.
+         */
+        template <typename InputIterator,
+                  typename = typename std::enable_if_t<std::is_base_of_v<std::input_iterator_tag,
+                    typename std::iterator_traits<InputIterator>::iterator_category>>>
+        void append_range(InputIterator first, InputIterator last)
+        {
+            // Si el rango se puede recorrer ms de una vez
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                typename std::iterator_traits<InputIterator>::iterator_category>)
+            {
+                // El nmero de elementos es la distancia entre los iteradores.
+                size_type count = std::distance(first, last);
+                // Reservar espacio para count elementos al final del contenedor
+                // y guardar el nuevo final de la secuencia.
+                iterator new_finish = this->reserve_elements_at_back(count);
+                // Copiar los elementos despus del ltimo elemento.
+                this->copy_by_chunks(first, count, this->finish);
+                // Actualizar el final de la secuencia.
+                this->finish = new_finish;
+            }
+            else // De lo contrario, agregar los elementos uno por uno.
+            {
+                for (; first != last; ++first)
+                    this->emplace_back(*first);
+            }
+        }
+
+        /**
+         * Agrega los elementos de @a init_list al final del contenedor.
+         *
+         * @param init_list Objeto initializer_list desde donde se agregan los nuevos elementos.
+         */
+        void append_range(std::initializer_list<value_type> init_list)
+        {
+            this->append_range(init_list.begin(), init_list.end());
+        }
+
+        /**
+         * Agrega los elementos en el rango [@a first, @a last) al inicio del contenedor,
+         * conservando su orden.
+         *
+         * Si el rango permite calcular su tamao de antemano, se reservan todos los
+         * fragmentos de memoria necesarios de una sola vez y los elementos se copian
+         * fragmento por fragmento.
+         *
+         * @param first, last   Iteradores a las posiciones inicial y final en un rango.
+         */
+        template <typename InputIterator,
+                  typename = typename std::enable_if_t<std::is_base_of_v<std::input_iterator_tag,
+                    typename std::iterator_traits<InputIterator>::iterator_category>>>
+        void prepend_range(InputIterator first, InputIterator last)
+        {
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag,
+                typename std::iterator_traits<InputIterator>::iterator_category>)
+            {
+                size_type count = std::distance(first, last);
+                // Reservar espacio para count elementos al inicio del contenedor
+                // y guardar el nuevo inicio de la secuencia.
+                iterator new_start = this->reserve_elements_at_front(count);
+                // Copiar los elementos desde el nuevo inicio.
+                this->copy_by_chunks(first, count, new_start);
+                // Actualizar el inicio de la secuencia.
+                this->start = new_start;
+            }
+            else
+            {
+                // No se conoce el tamao del rango, as que primero se
+                // guardan sus elementos en un deque temporal.
+                deque temp_deque;
+                temp_deque.append_range(first, last);
+                this->prepend_range(temp_deque.begin(), temp_deque.end());
+            }
+        }
+
+        /**
+         * Agrega los elementos de @a init_list al inicio del contenedor.
+         *
+         * @param init_list Objeto initializer_list desde donde se agregan los nuevos elementos.
+         */
+        void prepend_range(std::initializer_list<value_type> init_list)
+        {
+            this->prepend_range(init_list.begin(), init_list.end());
+        }
+
         /**
          * Elimina el ltimo elemento del contenedor y reduce su tamao.
          */
@@ -908,19 +1104,17 @@ namespace mySTL
                 // (Ya que finish siempre apunta al elemento 
                 // *siguiente al ltimo* del contenedor).
                 --this->finish.current;
-                // Destruir el elemento.
-                delete this->finish.current;
+                // El elemento vive dentro del fragmento de memoria y se
+                // destruye junto con l, por lo que no se libera por separado.
             }
             else // De lo contrario
             {
                 // Destruir el ltimo fragmento de memoria.
-                delete [] this->finish.first;
+                this->release_back_node(this->finish.node);
                 // Reajustar el iterador finish para que apunte al
                 // nodo anterior.
                 this->finish.set_node(this->finish.node - 1);
                 this->finish.current = this->finish.last - 1;
-                // Destruir el elemento.
-                delete this->finish.current;
             }
         }
 
@@ -932,19 +1126,15 @@ namespace mySTL
             // Si el primer fragmento de memoria contiene al menos dos elementos
             if (this->start.current != this->start.last - 1)
             {
-                // Destruir el primer elemento.
-                delete this->start.current;
                 // Incrementar el iterador start para que apunte
                 // al elemento siguiente al eliminado.
                 ++this->start.current;
             }
             else // De lo contrario
             {
-                // Destruir el primer y nico elemento
-                // del primer fragmento de memoria.
-                delete this->start.current;
-                // Destruir el fragmento de memoria.
-                delete [] this->start.first;
+                // Destruir el fragmento de memoria junto con
+                // su ltimo elemento.
+                this->release_front_node(this->start.node);
                 // Reajustar el iterador first para que apunte al
                 // nodo siguiente.
                 this->start.set_node(this->start.node + 1);
@@ -952,6 +1142,72 @@ namespace mySTL
             }
         }
 
+        /**
+         * Elimina los primeros @a count elementos del contenedor y reduce su tamao.
+         *
+         * Los fragmentos de memoria que quedan vacos se liberan en un solo paso.
+         *
+         * @param count El nmero de elementos por eliminar. No debe ser mayor al
+         * tamao del contenedor.
+         */
+        void pop_front_n(size_type count)
+        {
+            this->release_front(this->start + difference_type(count));
+        }
+
+        /**
+         * Mueve los primeros @a count elementos del contenedor al rango que empieza en
+         * @a result y luego los elimina del contenedor.
+         *
+         * Los elementos se mueven en tramos contiguos, un fragmento de memoria a la vez,
+         * y los fragmentos que quedan vacos se liberan en un solo paso.
+         *
+         * @param count     El nmero de elementos por mover. No debe ser mayor al
+         * tamao del contenedor.
+         * @param result    Iterador a la posicin inicial de la secuencia destino.
+         * @return Iterador al final del rango destino donde se movieron los elementos.
+         */
+        template <typename OutputIterator>
+        OutputIterator pop_front_n(size_type count, OutputIterator result)
+        {
+            // Iterador al siguiente elemento por mover.
+            iterator current = this->start;
+
+            // Mientras queden elementos por mover
+            while (count > 0)
+            {
+                // El tramo actual abarca hasta el final del fragmento de
+                // memoria, o hasta el ltimo elemento por mover.
+                size_type segment = mySTL::min(count, size_type(current.last - current.current));
+                // Mover el tramo a la secuencia destino.
+                result = this->move_segment(current.current, current.current + segment, result);
+                // Avanzar al siguiente tramo.
+                current += difference_type(segment);
+                count -= segment;
+            }
+
+            // Liberar los fragmentos vaciados y actualizar el inicio de la secuencia.
+            this->release_front(current);
+            return result;
+        }
+
+        /**
+         * Mueve hasta @a max_count elementos desde el inicio del contenedor al rango que
+         * empieza en @a result y los elimina del contenedor.
+         *
+         * @param result    Iterador a la posicin inicial de la secuencia destino.
+         * @param max_count El nmero mximo de elementos por mover.
+         * @return El nmero de elementos que se movieron.
+         */
+        template <typename OutputIterator>
+        size_type drain_front(OutputIterator result, size_type max_count)
+        {
+            // No se pueden mover ms elementos de los que hay en el contenedor.
+            size_type count = mySTL::min(max_count, size());
+            this->pop_front_n(count, result);
+            return count;
+        }
+
         /**
          * Inserta el valor @a value en la posicin @a position. 
          * 
@@ -1011,38 +1267,41 @@ namespace mySTL
                 // position (el iterador que apunta a la posicin).
                 difference_type index = position - begin();
 
+                // Construir el nuevo elemento antes de desplazar los dems, por si
+                // los argumentos hacen referencia a un elemento del contenedor.
+                value_type new_element(std::forward<Args>(args)...);
+
                 // Si la posicin de insercin es ms cercana al inicio del contenedor
                 if (index < (size() / 2))
                 {
-                    // Hacer una copia del primer elemento e insertarlo
+                    // Mover el primer elemento a una nueva posicin
                     // al inicio del contenedor.
-                    this->push_front(front());
+                    this->push_front(std::move(front()));
 
-                    // Ahora el valor del primer elemento se encuentra tanto en la 
-                    // primera como en la segunda posicin del contenedor.
+                    // Ahora la segunda posicin del contenedor tiene un valor
+                    // movido, que se sobrescribe al desplazar los elementos.
 
-                    // Copiar los elementos que estn entre la tercera posicin
+                    // Mover los elementos que estn entre la tercera posicin
                     // y la posicin de insercin, a su posicin anterior.
                     result = begin() + index;
-                    mySTL::copy(begin() + 2, result + 1, begin() + 1);
+                    this->move_range(begin() + 2, result + 1, begin() + 1);
                 }
                 else // De lo contrario
                 {
-                    // Hacer una copia del ltimo elemento e insertarlo
+                    // Mover el ltimo elemento a una nueva posicin
                     // al final del contenedor.
-                    this->push_back(back());
+                    this->push_back(std::move(back()));
 
-                    // Ahora el valor del ltimo elemento se encuentra 
-                    // en las ltimas dos posiciones del contenedor.
+                    // Ahora la penltima posicin del contenedor tiene un valor
+                    // movido, que se sobrescribe al desplazar los elementos.
 
-                    // Copiar los elementos que estn entre la posicin de 
+                    // Mover los elementos que estn entre la posicin de 
                     // insercin y la ltima posicin - 2, a su posicin siguiente.
                     result = begin() + index;
-                    mySTL::copy_backward(result, end() - 2, end() - 1);
+                    this->move_range_backward(result, end() - 2, end() - 1);
                 }
-                // Construir el nuevo elemento con los argumentos recibidos,
-                // en la posicin de insercin.
-                *result = value_type(std::forward<Args>(args)...);
+                // Mover el nuevo elemento a la posicin de insercin.
+                *result = std::move(new_element);
             }
 
             return result;
@@ -1112,22 +1371,22 @@ namespace mySTL
                         // suficiente para count elementos
                         if (elements_before_pos >= count)
                         {
-                            // Copiar los primeros count elementos del contenedor al
+                            // Mover los primeros count elementos del contenedor al
                             // nuevo inicio.
                             iterator last_of_first_elements = this->start + count;
-                            mySTL::copy(this->start, last_of_first_elements, new_start);
+                            this->move_range(this->start, last_of_first_elements, new_start);
                             // Actualizar el inicio de la secuencia.
                             this->start = new_start;
-                            // Copiar los elementos restantes al viejo inicio.
-                            mySTL::copy(last_of_first_elements, result, old_start);
+                            // Mover los elementos restantes al viejo inicio.
+                            this->move_range(last_of_first_elements, result, old_start);
                             // Llenar con value los espacios restantes correspondientes.
                             mySTL::fill(result - count, result, value);
                         }
                         else
                         {
-                            // Copiar los elementos entre el viejo inicio y la posicin
+                            // Mover los elementos entre el viejo inicio y la posicin
                             // de insercin, al nuevo inicio.
-                            iterator end_of_range = mySTL::copy(this->start, result, new_start);
+                            iterator end_of_range = this->move_range(this->start, result, new_start);
                             // Llenar con value los espacios restantes hasta el viejo inicio.
                             mySTL::fill(end_of_range, this->start, value);
                             // Actualizar el inicio de la secuencia.
@@ -1155,15 +1414,15 @@ namespace mySTL
                         // suficiente para count elementos
                         if (elements_after_pos > count)
                         {
-                            // Copiar los ultimos count elementos del contenedor a los
+                            // Mover los ultimos count elementos del contenedor a los
                             // nuevos espacios despus del viejo final.
                             iterator first_of_last_elements = this->finish - count;
-                            mySTL::copy(first_of_last_elements, this->finish, this->finish);
+                            this->move_range(first_of_last_elements, this->finish, this->finish);
                             // Actualizar el final de la secuencia.
                             this->finish = new_finish;
-                            // Copiar los elementos restantes a las posiciones anteriores
+                            // Mover los elementos restantes a las posiciones anteriores
                             // al viejo final.
-                            mySTL::copy_backward(result, first_of_last_elements, old_finish);
+                            this->move_range_backward(result, first_of_last_elements, old_finish);
                             // Llenar con value los espacios correspondientes desde 
                             // la posicin de insercin.
                             mySTL::fill(result, result + count, value);
@@ -1173,10 +1432,10 @@ namespace mySTL
                             // Llenar con value los espacios correspondientes desde
                             // el viejo final.
                             mySTL::fill(this->finish, result + count, value);
-                            // Copiar los elementos entre la posicin de insercin
+                            // Mover los elementos entre la posicin de insercin
                             // y el viejo final, a la posicin despus del ltimo
                             // nuevo elemento insertado.
-                            mySTL::copy(result, this->finish, result + count);
+                            this->move_range(result, this->finish, result + count);
                             // Actualizar el final de la secuencia.
                             this->finish = new_finish;
                             // Llenar con value los espacios entre la posicin
@@ -1214,26 +1473,18 @@ namespace mySTL
 
                 if (position.current == this->start.current)
                 {
-                    // Reservar espacio para count elementos al inicio del contenedor
-                    // y guardar el nuevo inicio de la secuencia.
-                    iterator new_start = this->reserve_elements_at_front(count);
-                    // Copiar los elementos del rango [first, last) al contenedor
-                    // desde su nuevo inicio.
-                    mySTL::copy(first, last, new_start);
-                    // Actualizar el inicio de la secuencia.
-                    result = this->start = new_start;
+                    // Agregar los elementos al inicio del contenedor.
+                    this->prepend_range(first, last);
+                    result = this->start;
                 }
                 else if (position.current == this->finish.current)
                 {
-                    // Reservar espacio para count elementos al final del contenedor
-                    // y guardar el nuevo final de la secuencia.
-                    iterator new_finish = this->reserve_elements_at_back(count);
-                    // Copiar los elementos del rango [first, last) al contenedor
-                    // despus del ltimo elemento.
-                    mySTL::copy(first, last, this->finish);
-                    result = this->finish;
-                    // Actualizar el final de la secuencia.
-                    this->finish = new_finish;
+                    // Guardar el tamao anterior para ubicar
+                    // el primero de los nuevos elementos.
+                    size_type old_size = size();
+                    // Agregar los elementos al final del contenedor.
+                    this->append_range(first, last);
+                    result = this->start + difference_type(old_size);
                 }
                 else
                 {
@@ -1252,23 +1503,23 @@ namespace mySTL
                         // suficiente para count elementos
                         if (elements_before_pos >= count)
                         {
-                            // Copiar los primeros count elementos del contenedor al
+                            // Mover los primeros count elementos del contenedor al
                             // nuevo inicio.
                             iterator last_of_first_elements = this->start + count;
-                            mySTL::copy(this->start, last_of_first_elements, new_start);
+                            this->move_range(this->start, last_of_first_elements, new_start);
                             // Actualizar el inicio de la secuencia.
                             this->start = new_start;
-                            // Copiar los elementos restantes al viejo inicio.
-                            mySTL::copy(last_of_first_elements, result, old_start);
+                            // Mover los elementos restantes al viejo inicio.
+                            this->move_range(last_of_first_elements, result, old_start);
                             // Copiar los elementos del rango [first, last) al contenedor
                             // desde su posicin correspondiente.
                             mySTL::copy(first, last, result - count);
                         }
                         else
                         {
-                            // Copiar los elementos entre el viejo inicio y la posicin
+                            // Mover los elementos entre el viejo inicio y la posicin
                             // de insercin, al nuevo inicio.
-                            iterator end_of_range = mySTL::copy(this->start, result, new_start);
+                            iterator end_of_range = this->move_range(this->start, result, new_start);
                             // Copiar los elementos del rango [first, last) al contenedor
                             // desde su posicin correspondiente.
                             InputIterator range_mid = first + (count - elements_before_pos);
@@ -1296,15 +1547,15 @@ namespace mySTL
                         // suficiente para count elementos
                         if (elements_after_pos > count)
                         {
-                            // Copiar los ultimos count elementos del contenedor a los
+                            // Mover los ultimos count elementos del contenedor a los
                             // nuevos espacios despus del viejo final.
                             iterator first_of_last_elements = this->finish - count;
-                            mySTL::copy(first_of_last_elements, this->finish, this->finish);
+                            this->move_range(first_of_last_elements, this->finish, this->finish);
                             // Actualizar el final de la secuencia.
                             this->finish = new_finish;
-                            // Copiar los elementos restantes a las posiciones anteriores
+                            // Mover los elementos restantes a las posiciones anteriores
                             // al viejo final.
-                            mySTL::copy_backward(result, first_of_last_elements, old_finish);
+                            this->move_range_backward(result, first_of_last_elements, old_finish);
                             // Copiar los elementos del rango [first, last) al contenedor
                             // desde su posicin correspondiente.
                             mySTL::copy(first, last, result);
@@ -1316,10 +1567,10 @@ namespace mySTL
                             // al final del contenedor.
                             InputIterator range_mid = first + elements_after_pos;
                             iterator end_of_range = mySTL::copy(range_mid, last, this->finish);
-                            // Copiar los elementos que estn entre la posicin de
+                            // Mover los elementos que estn entre la posicin de
                             // insercin y el final, a la posicin despus de los nuevos
                             // elementos insertados.
-                            mySTL::copy(result, this->finish, end_of_range);
+                            this->move_range(result, this->finish, end_of_range);
                             // Actualizar el final de la secuencia.
                             this->finish = new_finish;
                             // Copiar los elementos restantes de [first, last)
@@ -1364,17 +1615,17 @@ namespace mySTL
             // en la primera mitad del contenedor
             if (index < (size() / 2))
             {
-                // Copiar todos los elementos desde el primero hasta el
+                // Mover todos los elementos desde el primero hasta el
                 // elemento en la posicin de eliminado, a su posicin siguiente.
-                mySTL::copy_backward(begin(), result, result + 1);
+                this->move_range_backward(begin(), result, result + 1);
                 // Eliminar el primer elemento.
                 this->pop_front();
             }
             else
             {
-                // Copiar todos los elementos desde el elemento en la
-                // posicin de eliminado hasta el ltimo, a su posicin anterior.
-                mySTL::copy_backward(result + 1, end(), result);
+                // Mover todos los elementos siguientes al de la
+                // posicin de eliminado, a su posicin anterior.
+                this->move_range(result + 1, end(), result);
                 // Eliminar el ltimo elemento.
                 this->pop_back();
             }
@@ -1414,10 +1665,10 @@ namespace mySTL
                 // es ms cercana al inicio del contenedor
                 if (first_index < ((size() - count) / 2))
                 {
-                    // Copiar los elementos que se encuentran entre
+                    // Mover los elementos que se encuentran entre
                     // el inicio del contenedor y first, a las posiciones
                     // anteriores al final del rango de eliminado.
-                    mySTL::copy_backward(this->start, first, last);
+                    this->move_range_backward(this->start, first, last);
                     // Desplazar el inicio de la secuencia
                     // segn el nmero de elementos por eliminar.
                     iterator new_start = this->start + count;
@@ -1432,17 +1683,17 @@ namespace mySTL
                     // y el nuevo inicio, destruirlo.
                     for (map_pointer current = this->start.node;
                          current < new_start.node; ++current)
-                        delete [] *current;
+                        this->release_front_node(current);
 
                     // Actualizar el inicio de la secuencia.
                     this->start = new_start;
                 }
                 else
                 {
-                    // Copiar los elementos que se encuentran entre
+                    // Mover los elementos que se encuentran entre
                     // last y el final del contenedor, a las posiciones
                     // a partir del inicio del rango de eliminado.
-                    mySTL::copy(last, this->finish, first);
+                    this->move_range(last, this->finish, first);
                     // Desplazar el final de la secuencia
                     // segn el nmero de elementos por eliminar.
                     iterator new_finish = this->finish - count;
@@ -1453,9 +1704,11 @@ namespace mySTL
                          element < this->finish.current; ++element)
                         delete element; */
 
-                    for (map_pointer current = new_finish.node + 1;
-                         current <= this->finish.node; ++current)
-                        delete [] *current;
+                    // Desde el extremo hacia adentro, para no separar
+                    // los fragmentos reservados de la secuencia.
+                    for (map_pointer current = this->finish.node;
+                         current > new_finish.node; --current)
+                        this->release_back_node(current);
 
                     // Actualizar el final de la secuencia.
                     this->finish = new_finish;
@@ -1479,56 +1732,47 @@ namespace mySTL
             swap(this->map_size, other.map_size);
             swap(this->start, other.start);
             swap(this->finish, other.finish);
+            swap(this->statistics, other.statistics);
         }
 
         /**
          * Elimina todos los elementos del contenedor.
+         *
+         * Los elementos viven dentro de los fragmentos de memoria, as que se destruyen
+         * fragmento por fragmento al liberar cada uno. Se conserva un nico fragmento,
+         * movido al centro del mapa, para que volver a llenar el contenedor no requiera
+         * asignar memoria de inmediato.
          */
         void clear() noexcept
         {
-            // Destruir cada fragmento de memoria excepto
-            // los apuntados por los nodos de los extremos.
-            for (map_pointer current_node = this->start.node + 1;
-                 current_node < this->finish.node; ++current_node)
+            // El fragmento que se conserva es el del inicio de la secuencia.
+            pointer kept_buffer = *this->start.node;
+
+            // Los elementos del fragmento conservado no se destruyen con l, as que
+            // se reinician para liberar sus recursos. Para tipos trivialmente
+            // destructibles no hace falta.
+            if constexpr (!std::is_trivially_destructible_v<value_type>)
             {
-                // Destruir todos los elementos del fragmento
-                // de memoria apuntado por el nodo actual.
-                for (pointer element = *current_node;
-                     element < *current_node + buffer_size(); ++element)
-                    delete element;
-
-                // Destruir el fragmento.
-                delete [] *current_node;
+                pointer last_element = (this->start.node == this->finish.node)
+                    ? this->finish.current : this->start.last;
+                for (pointer element = this->start.current; element < last_element; ++element)
+                    *element = value_type();
             }
-                
 
-            // Si hay ms de un nodo en el mapa
-            if (this->start.node != this->finish.node)
-            {
-                // Destruir todos los elementos del primer
-                // fragmento de memoria.
-                for (pointer element = this->start.current;
-                     element < this->start.last; ++element)
-                    delete element;
-
-                // Destruir todos los elementos del ltimo
-                // fragmento de memoria.
-                for (pointer element = this->finish.first;
-                     element < this->finish.current; ++element)
-                    delete element;
+            // Destruir los dems fragmentos (con sus elementos), incluidos los reservados.
+            *this->start.node = nullptr;
+            for (map_pointer current = this->map;
+                 current < this->map + this->map_size; ++current)
+                if (*current != nullptr)
+                    this->deallocate_node(current);
 
-                // Destruir el ltimo fragmento de memoria.
-                delete [] this->finish.first;
-            }
-            else // De lo contrario
-            {
-                // Destruir los elementos del nico fragmento de memoria.
-                for (pointer element = this->start.current;
-                     element < this->finish.current; ++element)
-                    delete element;
-            }
+            // Colocar el fragmento conservado en el centro del mapa.
+            map_pointer center_node = this->map + (this->map_size / 2);
+            *center_node = kept_buffer;
 
             // Actualizar iteradores.
+            this->start.set_node(center_node);
+            this->start.current = this->start.first;
             this->finish = this->start;
         }
 
@@ -1545,6 +1789,12 @@ namespace mySTL
             return my_deque_chunk_size( sizeof(value_type) );
         }
 
+        /**
+         * Retorna la cantidad mxima de fragmentos vacos que se conservan como
+         * reservados en cada extremo al eliminar elementos.
+         */
+        static constexpr size_type max_spare_nodes() noexcept { return 2; }
+
         /**
          * Inicializa el arreglo de punteros segn @a elements_count 
          * y asigna un fragmento a cada nodo.
@@ -1562,7 +1812,8 @@ namespace mySTL
             // De lo contrario, asignar el nmero de nodos ms 2.
             this->map_size = mySTL::max(size_type(8), nodes_count + 2);
             // Inicializar el arreglo de punteros con el tamao calculado.
-            this->map = new pointer[map_size];
+            // Los nodos sin fragmento de memoria son nulos.
+            this->map = new pointer[map_size]();
 
             // Asignar punteros a nodos de inicio y final de manera que en 
             // ambos extremos del contenedor quede al menos un nodo vaco.
@@ -1589,19 +1840,106 @@ namespace mySTL
          */
         void destroy_map_and_nodes()
         {
-            // Destruir cada fragmento de memoria apuntado
-            // desde start hasta finish.
-            for (map_pointer current = this->start.node;
-                 current <= this->finish.node; ++current)
-                delete [] *current;
+            // Destruir cada fragmento de memoria del mapa, con sus elementos,
+            // incluyendo los reservados antes de start y despus de finish.
+            // Los nodos sin fragmento son nulos.
+            for (map_pointer current = this->map;
+                 current < this->map + this->map_size; ++current)
+                if (*current != nullptr)
+                    delete [] *current;
 
             delete [] this->map; // Destruir arreglo de nodos.
         }
 
+        /**
+         * Asigna un fragmento de memoria al nodo @a node, si no tiene uno reservado.
+         *
+         * @param node  Nodo del mapa.
+         */
+        void allocate_node(map_pointer node)
+        {
+            if (*node == nullptr)
+                *node = new value_type[ buffer_size() ];
+        }
+
+        /**
+         * Destruye el fragmento de memoria del nodo @a node y deja el nodo nulo.
+         *
+         * @param node  Nodo del mapa.
+         */
+        void deallocate_node(map_pointer node) noexcept
+        {
+            delete [] *node;
+            *node = nullptr;
+        }
+
+        /**
+         * Destruye el fragmento del nodo @a node, que qued vaco al inicio de la
+         * secuencia. Si antes de l hay fragmentos reservados, se conserva como
+         * reservado, de manera que los nodos con fragmento sigan siendo contiguos, y
+         * se destruyen los reservados que excedan max_spare_nodes(). As, un deque
+         * usado como cola FIFO despus de reserve no acumula fragmentos vacos.
+         *
+         * @param node  Nodo del mapa.
+         */
+        void release_front_node(map_pointer node) noexcept
+        {
+            if (node == this->map || *(node - 1) == nullptr)
+            {
+                this->deallocate_node(node);
+                return;
+            }
+
+            // Destruir los fragmentos reservados ms lejanos que el lmite,
+            // desde el ms cercano hacia el extremo del mapa.
+            if (size_type(node - this->map) < max_spare_nodes())
+                return;
+            for (map_pointer current = node - max_spare_nodes(); *current != nullptr; --current)
+            {
+                this->deallocate_node(current);
+                if (current == this->map)
+                    break;
+            }
+        }
+
+        /**
+         * Destruye el fragmento del nodo @a node, que qued vaco al final de la
+         * secuencia. Si despus de l hay fragmentos reservados, se conserva como
+         * reservado, de manera que los nodos con fragmento sigan siendo contiguos, y
+         * se destruyen los reservados que excedan max_spare_nodes().
+         *
+         * @param node  Nodo del mapa.
+         */
+        void release_back_node(map_pointer node) noexcept
+        {
+            map_pointer map_end = this->map + this->map_size;
+            if (node + 1 == map_end || *(node + 1) == nullptr)
+            {
+                this->deallocate_node(node);
+                return;
+            }
+
+            // Destruir los fragmentos reservados ms lejanos que el lmite.
+            if (size_type(map_end - node) <= max_spare_nodes())
+                return;
+            for (map_pointer current = node + max_spare_nodes();
+                 current != map_end && *current != nullptr; ++current)
+                this->deallocate_node(current);
+        }
+
         /**
          * Realiza una reasignacin de los nodos del mapa o del mapa en s,
          * segn el espacio sobrante en los extremos y segn por cul extremo
          * se estn agregando los nuevos elementos.
+         *
+         * Los nodos con fragmento de memoria (los de la secuencia y los reservados
+         * contiguos a ella) forman una ventana. Si el mapa tiene al menos el triple
+         * de nodos que la ventana, solo se desplaza la ventana, dejando tres cuartas
+         * partes del espacio libre en el extremo por el que se agregan los nodos;
+         * de lo contrario, el mapa crece al doble (o a cuatro veces la ventana).
+         * As, un deque usado como cola FIFO desplaza la ventana despus de agregar
+         * al menos la mitad del mapa en nodos nuevos, y el costo de copiar los nodos
+         * es constante amortizado por nodo agregado.
          * 
          * @param num_of_nodes_to_add	El nmero de nodos que se agregan a map.
          * @param adding_at_front		Indica el extremo por el cual se agregan
@@ -1611,62 +1949,90 @@ namespace mySTL
         {
             // Guardar la cantidad actual/vieja de nodos del arreglo de nodos.
             size_type old_num_of_nodes = this->finish.node - this->start.node + 1;
+
+            // Contar los nodos con fragmentos reservados contiguos a cada extremo,
+            // que tambin deben conservarse en el nuevo rango de nodos.
+            size_type front_reserved = 0;
+            while (this->start.node - front_reserved != this->map
+                   && *(this->start.node - front_reserved - 1) != nullptr)
+                ++front_reserved;
+            size_type back_reserved = 0;
+            while (this->finish.node + back_reserved + 1 != this->map + this->map_size
+                   && *(this->finish.node + back_reserved + 1) != nullptr)
+                ++back_reserved;
+
+            // La ventana actual de nodos con fragmento: [window_first, window_last).
+            map_pointer window_first = this->start.node - front_reserved;
+            map_pointer window_last = this->finish.node + back_reserved + 1;
+            size_type window_size = window_last - window_first;
+
             // Calcular la cantidad nueva de nodos que va a tener el arreglo de nodos.
-            size_type new_num_of_nodes = old_num_of_nodes + num_of_nodes_to_add;
+            size_type new_num_of_nodes = window_size + num_of_nodes_to_add;
+
+            // Si el mapa tiene al menos el triple de la nueva cantidad de nodos,
+            // basta con desplazar la ventana. De lo contrario, el mapa debe crecer.
+            bool recenter = ( this->map_size >= (new_num_of_nodes * 3) );
 
-            // Puntero a nodo que va a apuntar al nuevo inicio del contenedor.
-            map_pointer new_start_node;
+            map_pointer new_map = this->map;
+            size_type new_map_size = this->map_size;
 
-            // Si el tamao del arreglo de punteros es mayor al doble 
-            // de la nueva cantidad de nodos, hay suficiente espacio 
-            // en el otro extremo del contenedor. Por lo tanto, solo hace falta
-            // desplazar los nodos.
-            if ( this->map_size > (new_num_of_nodes * 2) )
+            if (!recenter)
             {
-                // Calcular cuntos espacios deben desplazarse los nodos
-                // segn el tamao del mapa y la nueva cantidad de nodos.
-                new_start_node = map + (this->map_size - new_num_of_nodes) / 2;
-                // Verificar hacia dnde deben desplazarse los nodos.
-                if (adding_at_front)
-                    new_start_node += num_of_nodes_to_add;
-
-                // Si el nuevo inicio se encuentra a la izquierda del inicio actual
-                if (new_start_node < this->start.node)
-                    // Desplazar nodos hacia la izquierda.
-                    mySTL::copy(this->start.node, this->finish.node + 1, new_start_node);
-                else // De lo contrario
-                    // Desplazar nodos hacia la derecha.
-                    mySTL::copy_backward(this->start.node, this->finish.node + 1,
-                        new_start_node + old_num_of_nodes);
+                // Crecimiento geomtrico, con espacio para desplazar la ventana despus.
+                new_map_size = mySTL::max(this->map_size * 2, new_num_of_nodes * 4);
+                // Los nodos sin fragmento de memoria son nulos.
+                new_map = new pointer[new_map_size]();
             }
-            // De lo contrario, no hay suficiente espacio en los extremos
-            // y el mapa debe ser reasignado.
-            else
-            {
-                // Calcular el nuevo tamao del arreglo de nodos.
-                size_type new_map_size = this->map_size
-                    + mySTL::max(this->map_size, num_of_nodes_to_add) + 2;
 
-                // Crear el nuevo mapa con el nuevo tamao calculado.
-                map_pointer new_map = new pointer[new_map_size];
+            // Repartir el espacio libre: tres cuartas partes en el extremo por el
+            // que se agregan los nodos y una cuarta parte en el otro.
+            size_type free_nodes = new_map_size - new_num_of_nodes;
+            size_type front_free = adding_at_front ? (free_nodes - free_nodes / 4) : (free_nodes / 4);
+            map_pointer new_window_first = new_map + front_free;
+            if (adding_at_front)
+                new_window_first += num_of_nodes_to_add;
+            map_pointer new_window_last = new_window_first + window_size;
 
-                // Calcular el nuevo inicio en el nuevo mapa segn el nuevo tamao
-                // y la nueva cantidad de nodos.
-                new_start_node = new_map + (new_map_size - new_num_of_nodes) / 2;
-                if (adding_at_front)
-                    new_start_node += num_of_nodes_to_add;
+            if (recenter)
+            {
+                // Desplazar solo la ventana. Los nodos de origen y destino pueden
+                // traslaparse, as que se copia en la direccin adecuada.
+                if (new_window_first < window_first)
+                {
+                    mySTL::copy(window_first, window_last, new_window_first);
+                    // Los nodos que quedan libres al final de la vieja ventana son nulos.
+                    for (map_pointer current = mySTL::max(new_window_last, window_first);
+                         current < window_last; ++current)
+                        *current = nullptr;
+                }
+                else if (new_window_first > window_first)
+                {
+                    mySTL::copy_backward(window_first, window_last, new_window_last);
+                    for (map_pointer current = window_first;
+                         current < mySTL::min(new_window_first, window_last); ++current)
+                        *current = nullptr;
+                }
 
-                // Copiar los elementos al inicio del nuevo mapa.
-                mySTL::copy(this->start.node, this->finish.node + 1, new_start_node);
+                ++this->statistics.recenters;
+            }
+            else
+            {
+                // Copiar la ventana al nuevo mapa.
+                mySTL::copy(window_first, window_last, new_window_first);
 
                 delete [] this->map; // Destruir mapa actual.
 
                 // Asignar a los atributos el nuevo mapa y su nuevo tamao.
                 this->map = new_map;
                 this->map_size = new_map_size;
+
+                ++this->statistics.reallocations;
             }
 
+            this->statistics.moved_nodes += window_size;
+
             // Asignar iteradores.
+            map_pointer new_start_node = new_window_first + front_reserved;
             this->start.set_node(new_start_node);
             this->finish.set_node(new_start_node + old_num_of_nodes - 1);
         }
@@ -1727,7 +2093,7 @@ namespace mySTL
             // Crear los nuevos nodos despus del ltimo nodo del mapa.
             for (size_type current = 1; current <= new_nodes_count; ++current)
                 // Inicializar el nuevo fragmento de memoria actual.
-                *(this->finish.node + current) = new value_type[ buffer_size() ];
+                this->allocate_node(this->finish.node + current);
         }
 
         /**
@@ -1742,12 +2108,12 @@ namespace mySTL
             size_type new_nodes_count = (new_elements_count + buffer_size() - 1)
                 / buffer_size();
 
-            this->reserve_map_at_back(new_nodes_count);
+            this->reserve_map_at_front(new_nodes_count);
 
             // Crear los nuevos nodos antes del primer nodo del mapa.
             for (size_type current = 1; current <= new_nodes_count; ++current)
                 // Inicializar el nuevo fragmento de memoria actual.
-                *(this->start.node - current) = new value_type[ buffer_size() ];
+                this->allocate_node(this->start.node - current);
         }
 
         /**
@@ -1798,6 +2164,194 @@ namespace mySTL
             return (this->start - difference_type(count));
         }
 
+        /**
+         * Elimina los elementos entre el inicio del contenedor y @a new_start,
+         * destruyendo de una sola vez los fragmentos de memoria que quedan vacos.
+         *
+         * @param new_start Iterador que apunta al nuevo primer elemento.
+         */
+        void release_front(iterator new_start) noexcept
+        {
+            // Destruir los fragmentos de memoria anteriores al del nuevo inicio.
+            for (map_pointer current = this->start.node;
+                 current < new_start.node; ++current)
+                this->release_front_node(current);
+
+            // Actualizar el inicio de la secuencia.
+            this->start = new_start;
+        }
+
+        /**
+         * Mueve los elementos del tramo contiguo [@a first, @a last) al rango que
+         * empieza en @a result.
+         *
+         * Si el destino es un arreglo contiguo de elementos trivialmente copiables,
+         * el tramo se copia con una sola llamada a memcpy.
+         *
+         * @param first, last   Punteros a las posiciones inicial y final del tramo.
+         * @param result        Iterador a la posicin inicial de la secuencia destino.
+         * @return Iterador al final del rango destino.
+         */
+        template <typename OutputIterator>
+        static OutputIterator move_segment(pointer first, pointer last, OutputIterator result)
+        {
+            if constexpr (std::is_same_v<OutputIterator, pointer>
+                && std::is_trivially_copyable_v<value_type>)
+            {
+                std::memcpy(result, first, (last - first) * sizeof(value_type));
+                return result + (last - first);
+            }
+            else
+            {
+                for (; first != last; ++first, ++result)
+                    *result = std::move(*first);
+                return result;
+            }
+        }
+
+        /**
+         * Mueve los elementos del rango [@a first, @a last) del contenedor al rango que
+         * empieza en @a result, un tramo contiguo a la vez: el ms largo que cabe tanto
+         * en el fragmento de memoria de origen como en el de destino.
+         *
+         * Los rangos pueden traslaparse si @a result est antes de @a first. Para
+         * elementos trivialmente copiables, cada tramo se copia con memmove.
+         *
+         * @param first, last   Iteradores a las posiciones inicial y final del rango.
+         * @param result        Iterador a la posicin inicial del rango destino.
+         * @return Iterador al final del rango destino.
+         */
+        static iterator move_range(iterator first, iterator last, iterator result)
+        {
+            difference_type remaining = last - first;
+
+            // Mover un elemento sobre s mismo podra dejarlo vaco.
+            if (first == result)
+                return result + remaining;
+
+            while (remaining > 0)
+            {
+                difference_type segment = mySTL::min(remaining,
+                    mySTL::min(difference_type(first.last - first.current),
+                        difference_type(result.last - result.current)));
+
+                if constexpr (std::is_trivially_copyable_v<value_type>)
+                    std::memmove(result.current, first.current, segment * sizeof(value_type));
+                else
+                    for (difference_type index = 0; index < segment; ++index)
+                        result.current[index] = std::move(first.current[index]);
+
+                first += segment;
+                result += segment;
+                remaining -= segment;
+            }
+
+            return result;
+        }
+
+        /**
+         * Mueve los elementos del rango [@a first, @a last) del contenedor al rango que
+         * termina en @a result, empezando desde el final, un tramo contiguo a la vez.
+         *
+         * Los rangos pueden traslaparse si @a result est despus de @a last. Para
+         * elementos trivialmente copiables, cada tramo se copia con memmove.
+         *
+         * @param first, last   Iteradores a las posiciones inicial y final del rango.
+         * @param result        Iterador a la posicin siguiente a la ltima del rango destino.
+         * @return Iterador al inicio del rango destino.
+         */
+        static iterator move_range_backward(iterator first, iterator last, iterator result)
+        {
+            difference_type remaining = last - first;
+
+            // Mover un elemento sobre s mismo podra dejarlo vaco.
+            if (last == result)
+                return result - remaining;
+
+            while (remaining > 0)
+            {
+                // Si un iterador est al inicio de su fragmento, el tramo
+                // termina al final del fragmento anterior.
+                pointer source_end = last.current;
+                difference_type source_available = last.current - last.first;
+                if (source_available == 0)
+                {
+                    source_available = difference_type( buffer_size() );
+                    source_end = *(last.node - 1) + source_available;
+                }
+
+                pointer target_end = result.current;
+                difference_type target_available = result.current - result.first;
+                if (target_available == 0)
+                {
+                    target_available = difference_type( buffer_size() );
+                    target_end = *(result.node - 1) + target_available;
+                }
+
+                difference_type segment = mySTL::min(remaining,
+                    mySTL::min(source_available, target_available));
+
+                if constexpr (std::is_trivially_copyable_v<value_type>)
+                    std::memmove(target_end - segment, source_end - segment,
+                        segment * sizeof(value_type));
+                else
+                    for (difference_type index = 1; index <= segment; ++index)
+                        *(target_end - index) = std::move(*(source_end - index));
+
+                last -= segment;
+                result -= segment;
+                remaining -= segment;
+            }
+
+            return result;
+        }
+
+        /**
+         * Copia @a count elementos del rango que empieza en @a first al espacio ya
+         * reservado que empieza en @a result, un fragmento de memoria a la vez.
+         *
+         * Si el rango de origen es un arreglo contiguo de elementos trivialmente
+         * copiables, cada tramo se copia con una sola llamada a memcpy.
+         *
+         * @param first     Iterador a la posicin inicial de la secuencia por copiar.
+         * @param count     El nmero de elementos por copiar.
+         * @param result    Iterador a la posicin inicial del espacio reservado.
+         * @return Iterador al final del rango destino donde se copiaron los elementos.
+         */
+        template <typename ForwardIterator>
+        iterator copy_by_chunks(ForwardIterator first, size_type count, iterator result)
+        {
+            // Mientras queden elementos por copiar
+            while (count > 0)
+            {
+                // El tramo actual abarca hasta el final del fragmento de
+                // memoria destino, o hasta el ltimo elemento por copiar.
+                size_type segment = mySTL::min(count, size_type(result.last - result.current));
+
+                if constexpr (std::is_pointer_v<ForwardIterator>
+                    && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<ForwardIterator>>, value_type>
+                    && std::is_trivially_copyable_v<value_type>)
+                {
+                    // Copiar el tramo completo de una sola vez.
+                    std::memcpy(result.current, first, segment * sizeof(value_type));
+                    first += segment;
+                }
+                else
+                {
+                    // Copiar el tramo elemento por elemento, sin revisar
+                    // los lmites del fragmento en cada paso.
+                    for (pointer current = result.current;
+                         current != result.current + segment; ++current, ++first)
+                        *current = *first;
+                }
+
+                // Avanzar al siguiente tramo.
+                result += difference_type(segment);
+                count -= segment;
+            }
+            return result;
+        }
+
     };
 
     // Funciones no miembros.
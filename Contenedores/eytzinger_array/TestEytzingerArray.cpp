@@ -0,0 +1,36 @@
+#include "TestEytzingerArray.h"
+
+int testEytzingerArray()
+{
+    std::cout << "Prueba de busqueda binaria:\n";
+
+    mySTL::vector<int> sorted;
+    for (int num = 10; num <= 100; num += 10)
+        sorted.push_back(num);
+
+    std::cout << "lower_bound(35): " << *mySTL::lower_bound(sorted.begin(), sorted.end(), 35) << '\n'; // 40
+    std::cout << "upper_bound(40): " << *mySTL::upper_bound(sorted.begin(), sorted.end(), 40) << '\n'; // 50
+    std::cout << "binary_search(70): " << mySTL::binary_search(sorted.begin(), sorted.end(), 70) << '\n'; // 1
+    std::cout << "binary_search(75): " << mySTL::binary_search(sorted.begin(), sorted.end(), 75) << '\n'; // 0
+    std::cout << '\n';
+
+    std::cout << "Prueba de eytzinger_array:\n";
+
+    mySTL::eytzinger_array<int> table(sorted);
+    std::cout << "Orden de Eytzinger: [ ";
+    for (int element : table)
+        std::cout << element << ' ';
+    std::cout << "]\n"; // [ 70 40 90 20 60 80 100 10 30 50 ]
+
+    std::cout << "lower_bound(35): " << *table.lower_bound(35) << '\n'; // 40
+    std::cout << "upper_bound(40): " << *table.upper_bound(40) << '\n'; // 50
+    std::cout << "lower_bound(101) es end: " << (table.lower_bound(101) == table.end()) << '\n'; // 1
+    std::cout << "contains(70): " << table.contains(70) << '\n'; // 1
+    std::cout << "contains(75): " << table.contains(75) << '\n'; // 0
+
+    mySTL::vector<int> restored = table.sorted();
+    std::cout << "Ordenado de nuevo: " << restored.front() << ", ..., " << restored.back() << '\n'; // 10, ..., 100
+    std::cout << '\n';
+
+    return 0;
+}
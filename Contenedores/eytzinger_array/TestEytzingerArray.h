@@ -0,0 +1,12 @@
+#ifndef TEST_EYTZINGER_ARRAY_H
+#define TEST_EYTZINGER_ARRAY_H
+
+#include "my_eytzinger_array.h"
+#include "../algorithm/my_algorithm.h"
+#include "../vector/my_vector.h"
+
+#include <iostream>
+
+int testEytzingerArray();
+
+#endif /* TEST_EYTZINGER_ARRAY_H */
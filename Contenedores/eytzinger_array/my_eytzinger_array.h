@@ -0,0 +1,306 @@
+#ifndef MY_EYTZINGER_ARRAY_H
+#define MY_EYTZINGER_ARRAY_H
+
+#include "../algorithm/my_algorithm.h"
+#include "../vector/my_vector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace mySTL
+{
+    /**
+     * @brief Copia de solo lectura de una secuencia ordenada, organizada para bsquedas
+     * rpidas en tablas que no caben en la cach.
+     *
+     * Los elementos se guardan en el orden de Eytzinger: el orden por niveles (BFS) del
+     * rbol binario de bsqueda completo que forma la secuencia. La raz est en la
+     * posicin 1 y los hijos del nodo k en 2k y 2k + 1. As, los primeros niveles del
+     * rbol, que todas las bsquedas recorren, quedan juntos en pocas lneas de cach, y
+     * los descendientes de un nodo a varios niveles de distancia son contiguos (los 16
+     * descendientes a cuatro niveles, si los elementos son de 4 bytes): en cada paso se
+     * pide a la cach la lnea donde estar el nodo de varios pasos ms abajo, de manera
+     * que la espera por la memoria se solapa con los pasos intermedios. El descenso es sin
+     * saltos condicionales: el siguiente nodo es 2k + (el nodo k es menor que el valor).
+     *
+     * A cambio, los elementos no se pueden recorrer en orden y no se pueden modificar:
+     * para cambiar la tabla hay que construirla de nuevo.
+     *
+     * @tparam ValueType    El tipo de los elementos que contiene.
+     * @tparam Compare      Criterio de comparacin con el que est ordenada la secuencia.
+     */
+    template <typename ValueType, typename Compare = std::less<ValueType>>
+    class eytzinger_array
+    {
+    // Tipos miembro pblicos
+    public:
+        // Primer parmetro de plantilla.
+        typedef ValueType value_type;
+        // Segundo parmetro de plantilla.
+        typedef Compare value_compare;
+        // Tipo entero sin signo.
+        typedef std::size_t size_type;
+        // Referencia constante.
+        typedef const value_type& const_reference;
+        // Puntero constante.
+        typedef const value_type* const_pointer;
+        // Iterador constante. Recorre los elementos en el orden de Eytzinger.
+        typedef const value_type* const_iterator;
+
+    // Atributos privados
+    private:
+        mySTL::vector<value_type> storage;  // Memoria de los elementos, con espacio para alinearlos.
+        value_type* tree;                   // Posicin 0 del rbol; la raz est en tree[1].
+        size_type count;                    // La cantidad de elementos.
+        value_compare compare;              // Criterio de comparacin.
+
+    // Mtodos pblicos
+    public:
+        /**
+         * Construye la tabla a partir de una secuencia ordenada segn @a compare.
+         *
+         * @param sorted    La secuencia ordenada.
+         * @param compare   Criterio de comparacin.
+         */
+        explicit eytzinger_array(const mySTL::vector<value_type>& sorted,
+            const value_compare& compare = value_compare())
+            : eytzinger_array(sorted.begin(), sorted.end(), compare)
+        {
+        }
+
+        /**
+         * Construye la tabla a partir del rango ordenado [@a first, @a last).
+         *
+         * @param first, last   Iteradores de acceso aleatorio a los lmites de la secuencia.
+         * @param compare       Criterio de comparacin.
+         */
+        template <typename RandomAccessIterator>
+        eytzinger_array(RandomAccessIterator first, RandomAccessIterator last,
+            const value_compare& compare = value_compare())
+            : storage()
+            , tree(nullptr)
+            , count(size_type(last - first))
+            , compare(compare)
+        {
+            // Si cada lnea de cach tiene una cantidad exacta de elementos, alinear la
+            // posicin 0 del rbol con una lnea: as los descendientes del nodo k que se
+            // piden a la cach, que empiezan en prefetch_block * k, ocupan una lnea.
+            const size_type line_elements = line_size / sizeof(value_type);
+            const bool aligned = line_elements > 0 && line_size % sizeof(value_type) == 0;
+            this->storage.resize(this->count + 1 + (aligned ? line_elements - 1 : 0));
+            this->tree = this->storage.data();
+            if (aligned)
+            {
+                const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(this->tree);
+                const std::uintptr_t misalignment = address % line_size;
+                if (misalignment != 0 && misalignment % sizeof(value_type) == 0)
+                    this->tree += (line_size - misalignment) / sizeof(value_type);
+            }
+
+            this->build(first, 0, 1);
+        }
+
+        /// Constructor de copia.
+        eytzinger_array(const eytzinger_array& other)
+            : eytzinger_array(other.sorted(), other.compare)
+        {
+        }
+
+        /// Operador de asignacin por copia.
+        eytzinger_array& operator=(const eytzinger_array& other)
+        {
+            if (this != &other)
+            {
+                eytzinger_array copy(other);
+                this->swap(copy);
+            }
+            return *this;
+        }
+
+        // Iteradores.
+
+        /// Retorna un iterador al primer elemento en el orden de Eytzinger (la raz).
+        inline const_iterator begin() const noexcept { return this->tree + 1; }
+
+        /// Retorna un iterador a la posicin despus del ltimo elemento.
+        inline const_iterator end() const noexcept { return this->tree + 1 + this->count; }
+
+        // Capacidad.
+
+        /// Verifica si la tabla est vaca.
+        inline bool empty() const noexcept { return this->count == 0; }
+
+        /// Retorna la cantidad de elementos.
+        inline size_type size() const noexcept { return this->count; }
+
+        // Bsqueda.
+
+        /**
+         * Busca el primer elemento, en el orden de la secuencia original, que no es menor
+         * que @a value.
+         *
+         * @param value El valor por buscar.
+         * @return Iterador al elemento, o end() si no hay.
+         */
+        const_iterator lower_bound(const value_type& value) const
+        {
+            size_type node = this->descend(value,
+                [this](const value_type& element, const value_type& key) { return this->compare(element, key); });
+            return node == 0 ? this->end() : this->tree + node;
+        }
+
+        /**
+         * Busca el primer elemento, en el orden de la secuencia original, que es mayor
+         * que @a value.
+         *
+         * @param value El valor por buscar.
+         * @return Iterador al elemento, o end() si no hay.
+         */
+        const_iterator upper_bound(const value_type& value) const
+        {
+            size_type node = this->descend(value,
+                [this](const value_type& element, const value_type& key) { return !this->compare(key, element); });
+            return node == 0 ? this->end() : this->tree + node;
+        }
+
+        /**
+         * Busca un elemento equivalente a @a value.
+         *
+         * @param value El valor por buscar.
+         * @return Iterador al elemento, o end() si no hay.
+         */
+        const_iterator find(const value_type& value) const
+        {
+            const_iterator position = this->lower_bound(value);
+            if (position != this->end() && !this->compare(value, *position))
+                return position;
+            return this->end();
+        }
+
+        /// Verifica si la tabla contiene un elemento equivalente a @a value.
+        inline bool contains(const value_type& value) const { return this->find(value) != this->end(); }
+
+        /// Retorna una copia de los elementos en el orden de la secuencia original.
+        mySTL::vector<value_type> sorted() const
+        {
+            mySTL::vector<value_type> result;
+            result.reserve(this->count);
+            this->collect(result, 1);
+            return result;
+        }
+
+        // Modificadores.
+
+        /**
+         * Intercambia el contenido con el de @a other.
+         *
+         * @param other Otra tabla del mismo tipo.
+         */
+        void swap(eytzinger_array& other) noexcept
+        {
+            this->storage.swap(other.storage);
+            std::swap(this->tree, other.tree);
+            std::swap(this->count, other.count);
+            std::swap(this->compare, other.compare);
+        }
+
+    // Constantes privadas
+    private:
+        static constexpr size_type line_size = 64;  // Tamao de una lnea de cach en bytes.
+
+        /**
+         * Retorna la mayor potencia de 2 de elementos que cabe en una lnea de cach: la
+         * cantidad de descendientes de un nodo que se piden a la cach en cada paso.
+         */
+        static constexpr size_type prefetch_block()
+        {
+            size_type block = 1;
+            while (2 * block * sizeof(value_type) <= line_size)
+                block *= 2;
+            return block;
+        }
+
+    // Mtodos privados
+    private:
+        /**
+         * Copia los elementos ordenados a partir de @a first en el subrbol con raz
+         * @a node, recorrindolo en orden (izquierda, nodo, derecha).
+         *
+         * @param first La secuencia ordenada.
+         * @param next  La posicin en la secuencia del siguiente elemento por copiar.
+         * @param node  La raz del subrbol.
+         * @return La posicin en la secuencia del siguiente elemento despus del subrbol.
+         */
+        template <typename RandomAccessIterator>
+        size_type build(RandomAccessIterator first, size_type next, size_type node)
+        {
+            if (node <= this->count)
+            {
+                next = this->build(first, next, 2 * node);
+                this->tree[node] = first[next++];
+                next = this->build(first, next, 2 * node + 1);
+            }
+            return next;
+        }
+
+        /**
+         * Agrega a @a result los elementos del subrbol con raz @a node, en orden.
+         *
+         * @param result    El vector al que se agregan los elementos.
+         * @param node      La raz del subrbol.
+         */
+        void collect(mySTL::vector<value_type>& result, size_type node) const
+        {
+            if (node <= this->count)
+            {
+                this->collect(result, 2 * node);
+                result.push_back(this->tree[node]);
+                this->collect(result, 2 * node + 1);
+            }
+        }
+
+        /**
+         * Baja por el rbol desde la raz: a la derecha si @a goes_right(nodo, @a value),
+         * a la izquierda si no. El resultado es el ltimo nodo desde el que se baj a la
+         * izquierda.
+         *
+         * @param value         El valor por buscar.
+         * @param goes_right    Predicado que indica si la respuesta est despus del nodo.
+         * @return La posicin en el rbol del resultado, o 0 si siempre se baj a la derecha.
+         */
+        template <typename Predicate>
+        size_type descend(const value_type& value, Predicate goes_right) const
+        {
+            constexpr size_type block = prefetch_block();
+            const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(this->tree);
+
+            size_type node = 1;
+            while (node <= this->count)
+            {
+                // La direccin puede estar fuera del arreglo; pedirla a la cach no la lee.
+                prefetch_read(reinterpret_cast<const void*>(base + block * node * sizeof(value_type)));
+                node = 2 * node + size_type(goes_right(this->tree[node], value));
+            }
+
+            // Cada bajada a la derecha agreg un 1 al final de node, y la ltima bajada a
+            // la izquierda, un 0. Quitar los unos y ese cero deja el nodo buscado.
+            return node >> (countr_one(node) + 1);
+        }
+
+        /// Retorna la cantidad de unos consecutivos al final de @a bits.
+        static inline unsigned countr_one(size_type bits) noexcept
+        {
+#if defined(__GNUC__)
+            return unsigned(__builtin_ctzll(~static_cast<unsigned long long>(bits)));
+#else
+            unsigned ones = 0;
+            for (; bits & 1; bits >>= 1)
+                ++ones;
+            return ones;
+#endif
+        }
+    };
+}
+
+#endif /* MY_EYTZINGER_ARRAY_H */
@@ -1,12 +1,32 @@
 #include "array/TestArray.h"
 #include "vector/TestVector.h"
 #include "deque/TestDeque.h"
+#include "circular_buffer/TestCircularBuffer.h"
+#include "tiered_vector/TestTieredVector.h"
+#include "spsc_queue/TestSpscQueue.h"
+#include "mpmc_queue/TestMpmcQueue.h"
+#include "work_stealing/TestWorkStealing.h"
+#include "monotonic_queue/TestMonotonicQueue.h"
+#include "spilling_deque/TestSpillingDeque.h"
+#include "queue/TestQueue.h"
+#include "stack/TestStack.h"
+#include "eytzinger_array/TestEytzingerArray.h"
 
 int main()
 {
     // testArray();
     // testVector();
     testDeque();
+    testCircularBuffer();
+    testTieredVector();
+    testSpscQueue();
+    testMpmcQueue();
+    testWorkStealing();
+    testMonotonicQueue();
+    testSpillingDeque();
+    testQueue();
+    testStack();
+    testEytzingerArray();
 
     return 0;
 }
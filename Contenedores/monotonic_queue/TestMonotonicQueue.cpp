@@ -0,0 +1,56 @@
+#include "TestMonotonicQueue.h"
+
+int testMonotonicQueue()
+{
+    std::cout << "Prueba de monotonic_queue con una ventana de 3 elementos:\n";
+
+    mySTL::monotonic_queue<int> window_min;
+    mySTL::monotonic_queue<int, std::greater<int>> window_max;
+    int values[] = { 5, 2, 8, 6, 1, 9, 7, 3 };
+
+    std::cout << "minimos: [ ";
+    for (int index = 0; index < 8; ++index)
+    {
+        window_min.push(values[index]);
+        // Mantener solo los ltimos 3 elementos.
+        if (index >= 3)
+            window_min.pop();
+        if (index >= 2)
+            std::cout << window_min.top() << ' ';
+    }
+    std::cout << "]\n"; // [ 2 2 1 1 1 3 ]
+
+    std::cout << "maximos: [ ";
+    for (int index = 0; index < 8; ++index)
+    {
+        window_max.push(values[index]);
+        if (index >= 3)
+            window_max.pop();
+        if (index >= 2)
+            std::cout << window_max.top() << ' ';
+    }
+    std::cout << "]\n"; // [ 8 8 8 9 9 9 ]
+    std::cout << '\n';
+
+    std::cout << "Prueba de monotonic_queue con marcas de tiempo:\n";
+
+    // Mediciones (tiempo en milisegundos, valor) con una ventana de 100 ms.
+    mySTL::monotonic_queue<double, std::greater<double>> latency_max;
+    latency_max.push(12.5, 1000);
+    latency_max.push(40.0, 1030);
+    latency_max.push(18.0, 1090);
+
+    latency_max.evict_before(1095 - 100);
+    std::cout << "Maximo en t = 1095: " << latency_max.top() << '\n'; // 40
+
+    latency_max.push(15.0, 1140);
+    latency_max.evict_before(1140 - 100);
+    std::cout << "Maximo en t = 1140: " << latency_max.top() << '\n'; // 18
+    std::cout << "Marca de tiempo: " << latency_max.top_timestamp() << '\n'; // 1090
+    std::cout << "Candidatos: " << latency_max.candidate_count() << '\n'; // 2
+
+    latency_max.evict_before(1300);
+    std::cout << "Vacia: " << ( latency_max.empty() ? "si" : "no" ) << "\n\n"; // si
+
+    return 0;
+}
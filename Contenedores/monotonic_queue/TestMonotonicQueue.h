@@ -0,0 +1,11 @@
+#ifndef TEST_MONOTONIC_QUEUE_H
+#define TEST_MONOTONIC_QUEUE_H
+
+#include "my_monotonic_queue.h"
+
+#include <functional>
+#include <iostream>
+
+int testMonotonicQueue();
+
+#endif /* TEST_MONOTONIC_QUEUE_H */
@@ -0,0 +1,159 @@
+#ifndef MY_MONOTONIC_QUEUE_H
+#define MY_MONOTONIC_QUEUE_H
+
+#include "../deque/my_deque.h"
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace mySTL
+{
+    /**
+     * @brief Adaptador de deque que mantiene el extremo (mnimo o mximo) de una
+     * ventana deslizante en tiempo constante amortizado.
+     *
+     * Solo se guardan los elementos que todava pueden ser el extremo de la ventana:
+     * al agregar un elemento, se eliminan del final los que no son mejores que l,
+     * porque van a salir de la ventana antes que el nuevo. As, los elementos
+     * guardados quedan ordenados segn @a Compare y el extremo siempre es el primero.
+     * Cada elemento entra y sale del deque a lo sumo una vez.
+     *
+     * Cada elemento tiene una marca de tiempo, que debe ser no decreciente. La ventana
+     * se puede manejar por tiempo (push con marca de tiempo y evict_before) o por
+     * cantidad de elementos (push sin marca de tiempo y pop), pero no de ambas formas
+     * en el mismo objeto.
+     *
+     * @tparam ValueType    El tipo de los elementos que contiene.
+     * @tparam Compare      Criterio de comparacin. Con std::less (por defecto) top
+     * retorna el mnimo; con std::greater, el mximo.
+     * @tparam TimeType     El tipo de las marcas de tiempo.
+     */
+    template <typename ValueType, typename Compare = std::less<ValueType>,
+        typename TimeType = long long>
+    class monotonic_queue
+    {
+    // Tipos miembro pblicos
+    public:
+        // Primer parmetro de plantilla.
+        typedef ValueType value_type;
+        // Segundo parmetro de plantilla.
+        typedef Compare value_compare;
+        // Tercer parmetro de plantilla.
+        typedef TimeType time_type;
+        // Tipo entero sin signo.
+        typedef std::size_t     size_type;
+        // Referencia constante.
+        typedef const value_type& const_reference;
+
+    // Tipos miembro privados
+    private:
+        /// Un elemento de la ventana con su marca de tiempo.
+        struct entry
+        {
+            value_type value;       // El valor del elemento.
+            time_type timestamp;    // El momento en que se agreg.
+        };
+
+    // Atributos privados
+    private:
+        mySTL::deque<entry> candidates; // Los elementos que pueden ser el extremo, ordenados.
+        value_compare compare;          // Criterio de comparacin.
+        time_type next_sequence;        // Marca del siguiente elemento sin marca de tiempo.
+        time_type first_sequence;       // Marca del elemento ms viejo de la ventana por cantidad.
+
+    // Mtodos pblicos
+    public:
+        /**
+         * Construye una ventana vaca.
+         *
+         * @param compare   Criterio de comparacin.
+         */
+        explicit monotonic_queue(const value_compare& compare = value_compare())
+            : candidates()
+            , compare(compare)
+            , next_sequence(0)
+            , first_sequence(0)
+        {
+        }
+
+        // Capacidad.
+
+        /// Verifica si la ventana est vaca.
+        inline bool empty() const noexcept { return this->candidates.empty(); }
+
+        /**
+         * Retorna la cantidad de elementos guardados, es decir, los que todava
+         * pueden ser el extremo. Es a lo sumo el tamao de la ventana.
+         */
+        inline size_type candidate_count() const noexcept { return this->candidates.size(); }
+
+        // Acceso a elementos.
+
+        /// Retorna el extremo de la ventana (el mnimo con std::less).
+        inline const_reference top() const { return this->candidates.front().value; }
+
+        /// Retorna la marca de tiempo del extremo de la ventana.
+        inline time_type top_timestamp() const { return this->candidates.front().timestamp; }
+
+        // Modificadores.
+
+        /**
+         * Agrega un elemento a la ventana con la marca de tiempo @a timestamp.
+         *
+         * @param value     El valor del elemento por agregar.
+         * @param timestamp La marca de tiempo. No puede ser menor que la del elemento
+         * agregado anteriormente.
+         */
+        void push(const value_type& value, time_type timestamp)
+        {
+            // Eliminar los elementos que ya no pueden ser el extremo: son ms viejos
+            // que el nuevo y no son mejores que l.
+            while (!this->candidates.empty()
+                   && !this->compare(this->candidates.back().value, value))
+                this->candidates.pop_back();
+
+            this->candidates.push_back(entry{ value, timestamp });
+        }
+
+        /**
+         * Agrega un elemento a una ventana manejada por cantidad de elementos.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push(const value_type& value)
+        {
+            this->push(value, this->next_sequence++);
+        }
+
+        /**
+         * Elimina el elemento ms viejo de una ventana manejada por cantidad de elementos.
+         * La ventana no debe estar vaca.
+         */
+        void pop()
+        {
+            this->evict_before(++this->first_sequence);
+        }
+
+        /**
+         * Elimina de la ventana los elementos con marca de tiempo menor que @a cutoff.
+         *
+         * @param cutoff    La marca de tiempo ms vieja que se conserva.
+         */
+        void evict_before(time_type cutoff)
+        {
+            while (!this->candidates.empty() && this->candidates.front().timestamp < cutoff)
+                this->candidates.pop_front();
+        }
+
+        /// Vaca la ventana.
+        void clear() noexcept
+        {
+            this->candidates.clear();
+            this->next_sequence = this->first_sequence = 0;
+        }
+    };
+
+}
+
+#endif /* MY_MONOTONIC_QUEUE_H */
@@ -0,0 +1,129 @@
+#include "TestMpmcQueue.h"
+
+int testMpmcQueue()
+{
+    std::cout << "Prueba de mpmc_queue en un solo hilo:\n";
+
+    mySTL::mpmc_queue<int> queue1(4);
+    std::cout << "Capacity of queue1: " << queue1.capacity() << '\n'; // 4
+
+    for (int num = 1; num <= 5; ++num)
+        std::cout << "try_push(" << num << "): "
+                  << ( queue1.try_push(num) ? "aceptado" : "rechazado" ) << '\n'; // El 5 se rechaza.
+
+    int value = 0;
+    int popped_placeholder[1] = { 0 };
+    queue1.pop(value);
+    std::cout << "pop: " << value << '\n'; // 1
+    std::cout << "Size of queue1: " << queue1.size() << '\n'; // 3
+
+    // Lotes vacos: retornan de inmediato aunque la cola no est llena ni vaca.
+    std::cout << "push_n vacio: " << queue1.push_n(popped_placeholder, 0) << '\n'; // 0
+    std::cout << "pop_n vacio: " << queue1.pop_n(popped_placeholder, 0) << '\n'; // 0
+
+    int more_ints[] = { 10, 20, 30 };
+    std::cout << "push_n: " << queue1.push_n(more_ints, 3) << '\n'; // 1 (solo cabe uno)
+
+    int popped[8];
+    std::size_t popped_count = queue1.pop_n(popped, 8);
+    std::cout << "pop_n: [ ";
+    for (std::size_t index = 0; index < popped_count; ++index)
+        std::cout << popped[index] << ' ';
+    std::cout << "]\n"; // [ 2 3 4 10 ]
+    std::cout << "try_pop: " << ( queue1.try_pop(value) ? "obtenido" : "vacia" ) << "\n\n"; // vacia
+
+    std::cout << "Prueba de mpmc_queue con 4 productores y 4 consumidores:\n";
+
+    const long long items_per_producer = 100000;
+    mySTL::mpmc_queue<long long> queue2(1024);
+    std::atomic<long long> sum(0);
+
+    std::thread producers[4];
+    std::thread consumers[4];
+
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        producers[thread] = std::thread([&queue2, thread, items_per_producer]()
+        {
+            for (long long item = 1; item <= items_per_producer; ++item)
+                queue2.push(thread * items_per_producer + item);
+        });
+
+        consumers[thread] = std::thread([&queue2, &sum, items_per_producer]()
+        {
+            long long local_sum = 0;
+            long long item = 0;
+            for (long long received = 0; received < items_per_producer; ++received)
+            {
+                queue2.pop(item);
+                local_sum += item;
+            }
+            sum += local_sum;
+        });
+    }
+
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        producers[thread].join();
+        consumers[thread].join();
+    }
+
+    std::cout << "Suma recibida: " << sum.load() << '\n'; // 80000200000
+    std::cout << "Vacia: " << ( queue2.empty() ? "si" : "no" ) << '\n'; // si
+    std::cout << '\n';
+
+    std::cout << "Prueba de mpmc_queue por lotes con 2 productores y 2 consumidores:\n";
+
+    mySTL::mpmc_queue<long long> queue3(256);
+    std::atomic<long long> batch_sum(0);
+    std::atomic<long long> batch_received(0);
+
+    std::thread batch_producers[2];
+    std::thread batch_consumers[2];
+
+    for (int thread = 0; thread < 2; ++thread)
+    {
+        batch_producers[thread] = std::thread([&queue3, thread, items_per_producer]()
+        {
+            long long batch[64];
+            for (long long item = 1; item <= items_per_producer; item += 64)
+            {
+                std::size_t count = std::size_t( mySTL::min(64LL, items_per_producer - item + 1) );
+                for (std::size_t index = 0; index < count; ++index)
+                    batch[index] = thread * items_per_producer + item + index;
+
+                // push_n puede aceptar solo una parte del lote.
+                std::size_t pushed = 0;
+                while ((pushed += queue3.push_n(batch + pushed, count - pushed)) < count)
+                    std::this_thread::yield();
+            }
+        });
+
+        batch_consumers[thread] = std::thread([&queue3, &batch_sum, &batch_received, items_per_producer]()
+        {
+            long long batch[64];
+            long long local_sum = 0;
+            while (batch_received.load() < 2 * items_per_producer)
+            {
+                std::size_t count = queue3.pop_n(batch, 64);
+                if (count == 0)
+                    std::this_thread::yield();
+                for (std::size_t index = 0; index < count; ++index)
+                    local_sum += batch[index];
+                batch_received += count;
+            }
+            batch_sum += local_sum;
+        });
+    }
+
+    for (int thread = 0; thread < 2; ++thread)
+    {
+        batch_producers[thread].join();
+        batch_consumers[thread].join();
+    }
+
+    std::cout << "Suma recibida: " << batch_sum.load() << '\n'; // 20000100000
+    std::cout << '\n';
+
+    return 0;
+}
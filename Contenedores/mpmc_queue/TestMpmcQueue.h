@@ -0,0 +1,12 @@
+#ifndef TEST_MPMC_QUEUE_H
+#define TEST_MPMC_QUEUE_H
+
+#include "my_mpmc_queue.h"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+int testMpmcQueue();
+
+#endif /* TEST_MPMC_QUEUE_H */
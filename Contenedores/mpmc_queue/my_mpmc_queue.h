@@ -0,0 +1,363 @@
+#ifndef MY_MPMC_QUEUE_H
+#define MY_MPMC_QUEUE_H
+
+#include "../algorithm/my_algorithm.h"
+#include "../circular_buffer/my_circular_buffer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+
+namespace mySTL
+{
+
+#ifndef MY_CACHE_LINE_SIZE
+#define MY_CACHE_LINE_SIZE 64
+#endif
+
+    /**
+     * @brief Cola acotada sin candados para varios productores y varios consumidores
+     * (algoritmo de Vyukov).
+     *
+     * Cada casilla del arreglo circular tiene un nmero de secuencia que indica
+     * de quin es el turno: si es igual a la posicin, la casilla est libre para el
+     * productor que obtenga esa posicin; si es igual a la posicin ms uno, tiene un
+     * elemento para el consumidor que obtenga esa posicin. Los productores y los
+     * consumidores obtienen posiciones con una operacin atmica sobre su propio
+     * contador, as que solo compiten entre ellos y no con el otro lado.
+     *
+     * Los mtodos try_ y los mtodos _n nunca esperan. Los mtodos push y pop
+     * esperan, cediendo el procesador, hasta que haya espacio o elementos.
+     *
+     * @tparam ValueType El tipo de los elementos que contiene.
+     */
+    template <typename ValueType>
+    class mpmc_queue
+    {
+    // Tipos miembro pblicos
+    public:
+        // Primer parmetro de plantilla.
+        typedef ValueType value_type;
+        // Tipo entero sin signo.
+        typedef std::size_t     size_type;
+        // Referencia.
+        typedef value_type& reference;
+        // Referencia constante.
+        typedef const value_type& const_reference;
+
+    // Tipos miembro privados
+    private:
+        /// Casilla del arreglo circular.
+        struct cell
+        {
+            std::atomic<size_type> sequence;    // El turno de la casilla.
+            value_type value;                   // El elemento guardado.
+        };
+
+    // Atributos privados
+    private:
+        // Datos que no cambian despus de la construccin.
+        alignas(MY_CACHE_LINE_SIZE) cell* cells;    // Arreglo circular de casillas.
+        size_type mask;                             // La capacidad del arreglo menos uno.
+
+        alignas(MY_CACHE_LINE_SIZE) std::atomic<size_type> enqueue_position; // Siguiente posicin para los productores.
+        alignas(MY_CACHE_LINE_SIZE) std::atomic<size_type> dequeue_position; // Siguiente posicin para los consumidores.
+
+    // Mtodos pblicos
+    public:
+        // Constructores y destructor.
+
+        /**
+         * Construye una cola vaca con capacidad para al menos @a capacity elementos.
+         * La capacidad se redondea a la siguiente potencia de dos.
+         *
+         * @param capacity  La cantidad mnima de elementos de la cola.
+         */
+        explicit mpmc_queue(size_type capacity)
+            : cells(new cell[ my_next_power_of_two(mySTL::max(capacity, size_type(2))) ])
+            , mask(my_next_power_of_two(mySTL::max(capacity, size_type(2))) - 1)
+            , enqueue_position(0)
+            , dequeue_position(0)
+        {
+            // Al inicio, cada casilla est libre para la posicin con su mismo ndice.
+            for (size_type index = 0; index <= this->mask; ++index)
+                this->cells[index].sequence.store(index, std::memory_order_relaxed);
+        }
+
+        // La cola no se puede copiar ni mover mientras otros hilos la usan.
+        mpmc_queue(const mpmc_queue&) = delete;
+        mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+        /**
+         * Destructor.
+         *
+         * Destruye el objeto contenedor.
+         */
+        ~mpmc_queue()
+        {
+            delete [] this->cells;
+        }
+
+        // Capacidad.
+
+        /// Retorna la cantidad mxima de elementos que puede contener la cola.
+        inline size_type capacity() const noexcept { return this->mask + 1; }
+
+        /// Retorna la cantidad aproximada de elementos (exacta si ningn otro hilo usa la cola).
+        inline size_type size() const noexcept
+        {
+            size_type current_dequeue = this->dequeue_position.load(std::memory_order_acquire);
+            size_type current_enqueue = this->enqueue_position.load(std::memory_order_acquire);
+            // Las posiciones se leen por separado, as que la resta podra ser negativa.
+            return ( (current_enqueue > current_dequeue) ? current_enqueue - current_dequeue : 0 );
+        }
+
+        /// Verifica si la cola est vaca (aproximado si otro hilo usa la cola).
+        inline bool empty() const noexcept { return (size() == 0); }
+
+        // Productores.
+
+        /**
+         * Intenta agregar un elemento al final de la cola.
+         *
+         * @param value El valor del elemento por agregar.
+         * @return TRUE si el elemento se agreg; FALSE si la cola estaba llena.
+         */
+        bool try_push(const value_type& value)
+        {
+            return this->try_emplace(value);
+        }
+
+        /**
+         * Intenta agregar un elemento al final de la cola.
+         *
+         * @param value El valor del elemento por agregar.
+         * @return TRUE si el elemento se agreg; FALSE si la cola estaba llena.
+         */
+        bool try_push(value_type&& value)
+        {
+            return this->try_emplace(std::forward<value_type>(value));
+        }
+
+        /**
+         * Intenta construir e insertar un elemento al final de la cola.
+         *
+         * @param args  Argumentos para construir el nuevo elemento.
+         * @return TRUE si el elemento se agreg; FALSE si la cola estaba llena.
+         */
+        template <typename... Args>
+        bool try_emplace(Args&&... args)
+        {
+            size_type position = this->enqueue_position.load(std::memory_order_relaxed);
+            cell* target = nullptr;
+
+            while (true)
+            {
+                target = &this->cells[position & this->mask];
+                size_type sequence = target->sequence.load(std::memory_order_acquire);
+
+                // La casilla est libre para esta posicin: intentar obtenerla.
+                if (sequence == position)
+                {
+                    if (this->enqueue_position.compare_exchange_weak(position, position + 1,
+                        std::memory_order_relaxed))
+                        break;
+                    // Otro productor la obtuvo; position ya tiene el valor actual.
+                }
+                // La casilla todava tiene el elemento de la vuelta anterior: la cola est llena.
+                else if (sequence < position)
+                    return false;
+                // Otro productor avanz; volver a leer la posicin.
+                else
+                    position = this->enqueue_position.load(std::memory_order_relaxed);
+            }
+
+            target->value = value_type(std::forward<Args>(args)...);
+            // Publicar el elemento para el consumidor de esta posicin.
+            target->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Agrega un elemento al final de la cola, esperando si est llena.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push(const value_type& value)
+        {
+            while (!this->try_emplace(value))
+                std::this_thread::yield();
+        }
+
+        /**
+         * Agrega un elemento al final de la cola, esperando si est llena.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push(value_type&& value)
+        {
+            while (!this->try_emplace(std::move(value)))
+                std::this_thread::yield();
+        }
+
+        /**
+         * Agrega a la cola tantos elementos del rango que empieza en @a first
+         * como quepan en casillas consecutivas, hasta @a count, obteniendo todas las
+         * posiciones con una sola operacin atmica.
+         *
+         * @param first Iterador a la posicin inicial de la secuencia por agregar.
+         * @param count El nmero de elementos por agregar.
+         * @return El nmero de elementos que se agregaron.
+         */
+        template <typename InputIterator>
+        size_type push_n(InputIterator first, size_type count)
+        {
+            // Sin elementos por agregar, el ciclo de abajo nunca obtendra casillas.
+            if (count == 0)
+                return 0;
+
+            size_type position = this->enqueue_position.load(std::memory_order_relaxed);
+            size_type claimed = 0;
+
+            while (true)
+            {
+                // Contar las casillas consecutivas libres para esta vuelta.
+                claimed = 0;
+                while (claimed < count && claimed <= this->mask
+                    && this->cells[(position + claimed) & this->mask].sequence.load(std::memory_order_acquire)
+                        == position + claimed)
+                    ++claimed;
+
+                if (claimed == 0)
+                {
+                    size_type sequence = this->cells[position & this->mask].sequence.load(std::memory_order_acquire);
+                    // La cola est llena.
+                    if (sequence < position)
+                        return 0;
+                    position = this->enqueue_position.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (this->enqueue_position.compare_exchange_weak(position, position + claimed,
+                    std::memory_order_relaxed))
+                    break;
+            }
+
+            for (size_type index = 0; index < claimed; ++index, ++first)
+            {
+                cell& target = this->cells[(position + index) & this->mask];
+                target.value = *first;
+                target.sequence.store(position + index + 1, std::memory_order_release);
+            }
+
+            return claimed;
+        }
+
+        // Consumidores.
+
+        /**
+         * Intenta mover el primer elemento de la cola hacia @a value y eliminarlo.
+         *
+         * @param value Referencia donde se guarda el elemento.
+         * @return TRUE si se obtuvo un elemento; FALSE si la cola estaba vaca.
+         */
+        bool try_pop(value_type& value)
+        {
+            size_type position = this->dequeue_position.load(std::memory_order_relaxed);
+            cell* source = nullptr;
+
+            while (true)
+            {
+                source = &this->cells[position & this->mask];
+                size_type sequence = source->sequence.load(std::memory_order_acquire);
+
+                // La casilla tiene el elemento de esta posicin: intentar obtenerla.
+                if (sequence == position + 1)
+                {
+                    if (this->dequeue_position.compare_exchange_weak(position, position + 1,
+                        std::memory_order_relaxed))
+                        break;
+                }
+                // El productor de esta posicin no ha terminado: la cola est vaca.
+                else if (sequence < position + 1)
+                    return false;
+                // Otro consumidor avanz; volver a leer la posicin.
+                else
+                    position = this->dequeue_position.load(std::memory_order_relaxed);
+            }
+
+            value = std::move(source->value);
+            // Liberar la casilla para el productor de la siguiente vuelta.
+            source->sequence.store(position + this->mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Mueve el primer elemento de la cola hacia @a value y lo elimina,
+         * esperando si la cola est vaca.
+         *
+         * @param value Referencia donde se guarda el elemento.
+         */
+        void pop(value_type& value)
+        {
+            while (!this->try_pop(value))
+                std::this_thread::yield();
+        }
+
+        /**
+         * Mueve hasta @a max_count elementos consecutivos del inicio de la cola al
+         * rango que empieza en @a result, obteniendo todas las posiciones con una
+         * sola operacin atmica.
+         *
+         * @param result    Iterador a la posicin inicial de la secuencia destino.
+         * @param max_count El nmero mximo de elementos por mover.
+         * @return El nmero de elementos que se movieron.
+         */
+        template <typename OutputIterator>
+        size_type pop_n(OutputIterator result, size_type max_count)
+        {
+            if (max_count == 0)
+                return 0;
+
+            size_type position = this->dequeue_position.load(std::memory_order_relaxed);
+            size_type claimed = 0;
+
+            while (true)
+            {
+                // Contar las casillas consecutivas que ya tienen elemento.
+                claimed = 0;
+                while (claimed < max_count && claimed <= this->mask
+                    && this->cells[(position + claimed) & this->mask].sequence.load(std::memory_order_acquire)
+                        == position + claimed + 1)
+                    ++claimed;
+
+                if (claimed == 0)
+                {
+                    size_type sequence = this->cells[position & this->mask].sequence.load(std::memory_order_acquire);
+                    // La cola est vaca.
+                    if (sequence < position + 1)
+                        return 0;
+                    position = this->dequeue_position.load(std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (this->dequeue_position.compare_exchange_weak(position, position + claimed,
+                    std::memory_order_relaxed))
+                    break;
+            }
+
+            for (size_type index = 0; index < claimed; ++index, ++result)
+            {
+                cell& source = this->cells[(position + index) & this->mask];
+                *result = std::move(source.value);
+                source.sequence.store(position + index + this->mask + 1, std::memory_order_release);
+            }
+
+            return claimed;
+        }
+    };
+
+}
+
+#endif /* MY_MPMC_QUEUE_H */
@@ -0,0 +1,54 @@
+#include "TestQueue.h"
+
+int testQueue()
+{
+    std::cout << "Prueba de queue:\n";
+
+    mySTL::queue<std::string> queue1;
+    queue1.push("uno");
+    queue1.push("dos");
+    queue1.emplace(3, 't');
+
+    std::cout << "front: " << queue1.front() << ", back: " << queue1.back() << '\n'; // front: uno, back: ttt
+    queue1.pop();
+    std::cout << "front: " << queue1.front() << ", size: " << queue1.size() << '\n'; // front: dos, size: 2
+
+    mySTL::queue<std::string> queue2;
+    queue2.push("dos");
+    queue2.push("ttt");
+    std::cout << "queue1 == queue2: " << ( queue1 == queue2 ? "si" : "no" ) << "\n\n"; // si
+
+    std::cout << "Prueba de priority_queue (monticulo 4-ario):\n";
+
+    int values[] = { 5, 2, 8, 6, 1, 9, 7, 3 };
+    mySTL::priority_queue<int> heap1;
+    for (int value : values)
+        heap1.push(value);
+
+    std::cout << "[ ";
+    while (!heap1.empty())
+    {
+        std::cout << heap1.top() << ' ';
+        heap1.pop();
+    }
+    std::cout << "]\n"; // [ 9 8 7 6 5 3 2 1 ]
+
+    // Montculo de mnimos binario, formado en tiempo lineal con push_range.
+    mySTL::priority_queue<int, mySTL::vector<int>, std::greater<int>, 2> heap2(values, values + 8);
+    int more[] = { 4, 0 };
+    heap2.push_range(more, more + 2);
+    std::cout << "Minimo: " << heap2.top() << ", size: " << heap2.size() << '\n'; // Minimo: 0, size: 10
+
+    // pop_push reemplaza el mnimo sin recorrer el montculo dos veces.
+    heap2.pop_push(10);
+    heap2.pop_push(11);
+    std::cout << "[ ";
+    while (!heap2.empty())
+    {
+        std::cout << heap2.top() << ' ';
+        heap2.pop();
+    }
+    std::cout << "]\n\n"; // [ 2 3 4 5 6 7 8 9 10 11 ]
+
+    return 0;
+}
@@ -0,0 +1,12 @@
+#ifndef TEST_QUEUE_H
+#define TEST_QUEUE_H
+
+#include "my_queue.h"
+
+#include <functional>
+#include <iostream>
+#include <string>
+
+int testQueue();
+
+#endif /* TEST_QUEUE_H */
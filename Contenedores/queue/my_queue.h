@@ -0,0 +1,434 @@
+#ifndef MY_QUEUE_H
+#define MY_QUEUE_H
+
+#include "../algorithm/my_algorithm.h"
+#include "../deque/my_deque.h"
+#include "../vector/my_vector.h"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace mySTL
+{
+    /**
+     * @brief Adaptador de contenedor que ofrece una cola FIFO: los elementos se
+     * agregan al final y se eliminan del inicio.
+     *
+     * @tparam ValueType    El tipo de los elementos que contiene.
+     * @tparam Container    El contenedor subyacente. Debe ofrecer front, back,
+     * push_back, emplace_back, pop_front, size y empty.
+     */
+    template <typename ValueType, typename Container = mySTL::deque<ValueType>>
+    class queue
+    {
+    // Tipos miembro pblicos
+    public:
+        // Segundo parmetro de plantilla.
+        typedef Container container_type;
+        // Primer parmetro de plantilla.
+        typedef typename Container::value_type value_type;
+        // Tipo entero sin signo.
+        typedef typename Container::size_type size_type;
+        // Referencia.
+        typedef typename Container::reference reference;
+        // Referencia constante.
+        typedef typename Container::const_reference const_reference;
+
+    // Atributos protegidos
+    protected:
+        container_type container; // El contenedor subyacente.
+
+    // Mtodos pblicos
+    public:
+        /// Construye una cola vaca.
+        queue()
+            : container()
+        {
+        }
+
+        /**
+         * Construye la cola con una copia de los elementos de @a container.
+         *
+         * @param container El contenedor con los elementos iniciales.
+         */
+        explicit queue(const container_type& container)
+            : container(container)
+        {
+        }
+
+        /**
+         * Construye la cola con los elementos de @a container, sin copiarlos.
+         *
+         * @param container El contenedor con los elementos iniciales.
+         */
+        explicit queue(container_type&& container)
+            : container(std::move(container))
+        {
+        }
+
+        // Capacidad.
+
+        /// Verifica si la cola est vaca.
+        inline bool empty() const { return this->container.empty(); }
+
+        /// Retorna la cantidad de elementos en la cola.
+        inline size_type size() const { return this->container.size(); }
+
+        // Acceso a elementos.
+
+        /// Retorna una referencia al elemento ms viejo de la cola.
+        inline reference front() { return this->container.front(); }
+        /// Retorna una referencia al elemento ms viejo de la cola.
+        inline const_reference front() const { return this->container.front(); }
+
+        /// Retorna una referencia al elemento ms reciente de la cola.
+        inline reference back() { return this->container.back(); }
+        /// Retorna una referencia al elemento ms reciente de la cola.
+        inline const_reference back() const { return this->container.back(); }
+
+        // Modificadores.
+
+        /**
+         * Agrega un elemento al final de la cola.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push(const value_type& value) { this->container.push_back(value); }
+
+        /**
+         * Agrega un elemento al final de la cola.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push(value_type&& value) { this->container.push_back(std::move(value)); }
+
+        /**
+         * Construye un elemento al final de la cola.
+         *
+         * @param args  Argumentos para construir el nuevo elemento.
+         */
+        template <typename... Args>
+        void emplace(Args&&... args) { this->container.emplace_back(std::forward<Args>(args)...); }
+
+        /// Elimina el elemento ms viejo de la cola. La cola no debe estar vaca.
+        void pop() { this->container.pop_front(); }
+
+        /**
+         * Intercambia el contenido de esta cola por el de @a other.
+         *
+         * @param other Otra cola del mismo tipo.
+         */
+        void swap(queue& other)
+        {
+            this->container.swap(other.container);
+        }
+
+        template <typename V, typename C>
+        friend bool operator==(const queue<V, C>& lhs, const queue<V, C>& rhs);
+    };
+
+    // Funciones no miembros.
+
+    // Operadores relacionales
+
+    template <typename ValueType, typename Container>
+    inline bool operator==(const queue<ValueType, Container>& lhs, const queue<ValueType, Container>& rhs)
+    {
+        return lhs.container == rhs.container;
+    }
+
+    template <typename ValueType, typename Container>
+    inline bool operator!=(const queue<ValueType, Container>& lhs, const queue<ValueType, Container>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    /**
+     * @brief Adaptador de contenedor que ofrece acceso en tiempo constante al elemento
+     * de mayor prioridad, con insercin y eliminacin en tiempo logartmico.
+     *
+     * Los elementos se guardan en un montculo d-ario implcito dentro del contenedor:
+     * los hijos del nodo i estn en las posiciones Arity * i + 1 hasta Arity * i + Arity,
+     * y su padre en (i - 1) / Arity. Con ms hijos por nodo el rbol es menos profundo,
+     * as que push y pop_push recorren menos niveles, y los hijos de un nodo quedan
+     * contiguos en memoria, por lo que compararlos en pop recorre pocas lneas de cach.
+     * Un montculo 4-ario suele ser ms rpido que el binario en la prctica.
+     *
+     * @tparam ValueType    El tipo de los elementos que contiene.
+     * @tparam Container    El contenedor subyacente. Debe ofrecer iteradores de acceso
+     * aleatorio, front, push_back, emplace_back, pop_back, size y empty.
+     * @tparam Compare      Criterio de comparacin. Con std::less (por defecto) top
+     * retorna el mayor elemento.
+     * @tparam Arity        La cantidad de hijos de cada nodo del montculo.
+     */
+    template <typename ValueType, typename Container = mySTL::vector<ValueType>,
+        typename Compare = std::less<typename Container::value_type>, std::size_t Arity = 4>
+    class priority_queue
+    {
+        static_assert(Arity >= 2, "mySTL::priority_queue: el montculo necesita al menos dos hijos por nodo");
+
+    // Tipos miembro pblicos
+    public:
+        // Segundo parmetro de plantilla.
+        typedef Container container_type;
+        // Tercer parmetro de plantilla.
+        typedef Compare value_compare;
+        // Primer parmetro de plantilla.
+        typedef typename Container::value_type value_type;
+        // Tipo entero sin signo.
+        typedef typename Container::size_type size_type;
+        // Referencia constante.
+        typedef typename Container::const_reference const_reference;
+
+    // Atributos protegidos
+    protected:
+        container_type container;   // El montculo.
+        value_compare compare;      // Criterio de comparacin.
+
+    // Mtodos pblicos
+    public:
+        /**
+         * Construye una cola de prioridad vaca.
+         *
+         * @param compare   Criterio de comparacin.
+         */
+        explicit priority_queue(const value_compare& compare = value_compare())
+            : container()
+            , compare(compare)
+        {
+        }
+
+        /**
+         * Construye la cola de prioridad con los elementos del rango [first, last),
+         * formando el montculo en tiempo lineal.
+         *
+         * @param first, last   Iteradores a las posiciones inicial y final en un rango.
+         * @param compare       Criterio de comparacin.
+         */
+        template <typename InputIterator>
+        priority_queue(InputIterator first, InputIterator last,
+            const value_compare& compare = value_compare())
+            : container()
+            , compare(compare)
+        {
+            this->push_range(first, last);
+        }
+
+        // Capacidad.
+
+        /// Verifica si la cola de prioridad est vaca.
+        inline bool empty() const { return this->container.empty(); }
+
+        /// Retorna la cantidad de elementos en la cola de prioridad.
+        inline size_type size() const { return this->container.size(); }
+
+        // Acceso a elementos.
+
+        /// Retorna el elemento de mayor prioridad.
+        inline const_reference top() const { return this->container.front(); }
+
+        // Modificadores.
+
+        /**
+         * Agrega un elemento a la cola de prioridad.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push(const value_type& value)
+        {
+            this->container.push_back(value);
+            this->sift_up(this->container.size() - 1);
+        }
+
+        /**
+         * Agrega un elemento a la cola de prioridad.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push(value_type&& value)
+        {
+            this->container.push_back(std::move(value));
+            this->sift_up(this->container.size() - 1);
+        }
+
+        /**
+         * Construye un elemento en la cola de prioridad.
+         *
+         * @param args  Argumentos para construir el nuevo elemento.
+         */
+        template <typename... Args>
+        void emplace(Args&&... args)
+        {
+            this->container.emplace_back(std::forward<Args>(args)...);
+            this->sift_up(this->container.size() - 1);
+        }
+
+        /**
+         * Agrega todos los elementos del rango [first, last).
+         *
+         * Si se agregan al menos tantos elementos como los que ya haba, se vuelve a
+         * formar el montculo completo de abajo hacia arriba, en tiempo lineal sobre el
+         * tamao final. Si se agregan pocos, conviene subir cada uno por separado.
+         *
+         * @param first, last   Iteradores a las posiciones inicial y final en un rango.
+         */
+        template <typename InputIterator>
+        void push_range(InputIterator first, InputIterator last)
+        {
+            const size_type old_size = this->container.size();
+            for (; first != last; ++first)
+                this->container.push_back(*first);
+
+            const size_type new_size = this->container.size();
+            if (new_size - old_size >= old_size)
+                this->make_heap();
+            else
+                for (size_type index = old_size; index < new_size; ++index)
+                    this->sift_up(index);
+        }
+
+        /// Elimina el elemento de mayor prioridad. La cola no debe estar vaca.
+        void pop()
+        {
+            const size_type last = this->container.size() - 1;
+            if (last > 0)
+            {
+                // Sacar el ltimo elemento y colocarlo en el hueco de la raz. Como
+                // viene de una hoja, casi siempre termina cerca de las hojas: conviene
+                // bajar el hueco hasta el fondo sin compararlo y despus subirlo.
+                value_type value = std::move(this->container.begin()[last]);
+                this->container.pop_back();
+                const size_type hole = this->sift_hole_to_leaf(0);
+                this->container.begin()[hole] = std::move(value);
+                this->sift_up(hole);
+            }
+            else
+                this->container.pop_back();
+        }
+
+        /**
+         * Reemplaza el elemento de mayor prioridad por @a value. Equivale a pop seguido
+         * de push, pero recorre el montculo una sola vez. La cola no debe estar vaca.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void pop_push(value_type value)
+        {
+            this->sift_down(0, std::move(value));
+        }
+
+        /**
+         * Intercambia el contenido de esta cola de prioridad por el de @a other.
+         *
+         * @param other Otra cola de prioridad del mismo tipo.
+         */
+        void swap(priority_queue& other)
+        {
+            using std::swap; // Funcin swap de la biblioteca estndar.
+            this->container.swap(other.container);
+            swap(this->compare, other.compare);
+        }
+
+    // Mtodos privados
+    private:
+        /**
+         * Sube el elemento en la posicin @a index hasta que su padre no tenga menor
+         * prioridad. Los ancestros se bajan un nivel y el elemento se escribe una sola
+         * vez al final, en el hueco que queda.
+         *
+         * @param index Posicin del elemento por subir.
+         */
+        void sift_up(size_type index)
+        {
+            auto heap = this->container.begin();
+            value_type value = std::move(heap[index]);
+            while (index > 0)
+            {
+                const size_type parent = (index - 1) / Arity;
+                if (!this->compare(heap[parent], value))
+                    break;
+                heap[index] = std::move(heap[parent]);
+                index = parent;
+            }
+            heap[index] = std::move(value);
+        }
+
+        /**
+         * Coloca @a value en el hueco de la posicin @a index y lo baja hasta que
+         * ningn hijo tenga mayor prioridad.
+         *
+         * @param index Posicin del hueco.
+         * @param value El valor por colocar.
+         */
+        void sift_down(size_type index, value_type value)
+        {
+            auto heap = this->container.begin();
+            const size_type heap_size = this->container.size();
+            for (;;)
+            {
+                const size_type first_child = Arity * index + 1;
+                if (first_child >= heap_size)
+                    break;
+
+                // Buscar el hijo de mayor prioridad.
+                const size_type last_child = mySTL::min(size_type(first_child + Arity), heap_size);
+                size_type best = first_child;
+                for (size_type child = first_child + 1; child < last_child; ++child)
+                    if (this->compare(heap[best], heap[child]))
+                        best = child;
+
+                if (!this->compare(value, heap[best]))
+                    break;
+                heap[index] = std::move(heap[best]);
+                index = best;
+            }
+            heap[index] = std::move(value);
+        }
+
+        /**
+         * Baja el hueco de la posicin @a index hasta una hoja, subiendo en cada
+         * nivel el hijo de mayor prioridad. Ahorra la comparacin con el valor que
+         * hace sift_down en cada nivel.
+         *
+         * @param index Posicin del hueco.
+         * @return la posicin de la hoja donde termina el hueco.
+         */
+        size_type sift_hole_to_leaf(size_type index)
+        {
+            auto heap = this->container.begin();
+            const size_type heap_size = this->container.size();
+            for (;;)
+            {
+                const size_type first_child = Arity * index + 1;
+                if (first_child >= heap_size)
+                    return index;
+
+                const size_type last_child = mySTL::min(size_type(first_child + Arity), heap_size);
+                size_type best = first_child;
+                for (size_type child = first_child + 1; child < last_child; ++child)
+                    if (this->compare(heap[best], heap[child]))
+                        best = child;
+
+                heap[index] = std::move(heap[best]);
+                index = best;
+            }
+        }
+
+        /// Forma el montculo completo, bajando cada nodo interno desde el ltimo.
+        void make_heap()
+        {
+            const size_type heap_size = this->container.size();
+            if (heap_size < 2)
+                return;
+
+            auto heap = this->container.begin();
+            for (size_type index = (heap_size - 2) / Arity + 1; index-- > 0; )
+                this->sift_down(index, std::move(heap[index]));
+        }
+    };
+
+}
+
+#endif /* MY_QUEUE_H */
@@ -0,0 +1,33 @@
+#include "TestSpillingDeque.h"
+
+int testSpillingDeque()
+{
+    std::cout << "Prueba de spilling_deque con fragmentos de 16 enteros y 4 en memoria:\n";
+
+    // Presupuesto de 256 bytes: 4 fragmentos de 64 bytes.
+    mySTL::spilling_deque<int> queue1(256, "/tmp", 64);
+
+    for (int num = 0; num < 1000; ++num)
+        queue1.push_back(num);
+
+    std::cout << "Size of queue1: " << queue1.size() << '\n'; // 1000
+    std::cout << "front: " << queue1.front() << ", back: " << queue1.back() << '\n'; // 0, 999
+    std::cout << "Fragmentos en memoria: " << queue1.resident_chunk_count() << '\n'; // 4
+    std::cout << "Fragmentos en el archivo: " << queue1.spilled_chunk_count() << '\n'; // 59
+
+    // Sacar todos los elementos y verificar que salen en orden.
+    bool in_order = true;
+    for (int num = 0; num < 1000; ++num)
+    {
+        if (queue1.front() != num)
+            in_order = false;
+        queue1.pop_front();
+    }
+
+    std::cout << "En orden: " << ( in_order ? "si" : "no" ) << '\n'; // si
+    std::cout << "Escritos: " << queue1.spill_stats().spills << '\n'; // 59
+    std::cout << "Leidos: " << queue1.spill_stats().loads << '\n'; // 59
+    std::cout << "Empty: " << ( queue1.empty() ? "si" : "no" ) << "\n\n"; // si
+
+    return 0;
+}
@@ -0,0 +1,10 @@
+#ifndef TEST_SPILLING_DEQUE_H
+#define TEST_SPILLING_DEQUE_H
+
+#include "my_spilling_deque.h"
+
+#include <iostream>
+
+int testSpillingDeque();
+
+#endif /* TEST_SPILLING_DEQUE_H */
@@ -0,0 +1,364 @@
+#ifndef MY_SPILLING_DEQUE_H
+#define MY_SPILLING_DEQUE_H
+
+#include "../algorithm/my_algorithm.h"
+#include "../deque/my_deque.h"
+#include "../vector/my_vector.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace mySTL
+{
+    /**
+     * @brief Cola FIFO que guarda en disco los fragmentos de memoria que no caben
+     * en un presupuesto de memoria.
+     *
+     * Igual que deque, los elementos se guardan en fragmentos de memoria de tamao
+     * fijo y un mapa (un deque de punteros a fragmentos) los ordena. Cuando la cantidad
+     * de fragmentos en memoria supera el presupuesto, el fragmento que se acaba de
+     * llenar al final se escribe con pwrite en un archivo temporal y se libera: es
+     * el que se va a necesitar de ltimo. El primer y el ltimo fragmento siempre
+     * estn en memoria.
+     *
+     * Cuando el consumidor avanza al siguiente fragmento, se empieza a leer de forma
+     * asncrona (con pread en otro hilo) el fragmento que sigue, de manera que
+     * normalmente ya est en memoria cuando se necesite.
+     *
+     * Requiere las funciones de POSIX pwrite, pread y mkstemp. El archivo se borra
+     * del directorio en cuanto se crea, as que desaparece al cerrarse aunque el
+     * proceso termine de forma inesperada.
+     *
+     * @tparam ValueType El tipo de los elementos que contiene. Debe ser trivialmente
+     * copiable, porque los fragmentos se escriben byte por byte.
+     */
+    template <typename ValueType>
+    class spilling_deque
+    {
+        static_assert(std::is_trivially_copyable_v<ValueType>,
+            "mySTL::spilling_deque requires a trivially copyable value_type");
+
+    // Tipos miembro pblicos
+    public:
+        // Primer parmetro de plantilla.
+        typedef ValueType value_type;
+        // Tipo entero sin signo.
+        typedef std::size_t     size_type;
+        // Referencia.
+        typedef value_type& reference;
+        // Referencia constante.
+        typedef const value_type& const_reference;
+        // Puntero.
+        typedef value_type* pointer;
+
+        /// Contadores de las transferencias entre la memoria y el archivo.
+        struct spill_statistics
+        {
+            size_type spills = 0;               // Fragmentos escritos en el archivo.
+            size_type loads = 0;                // Fragmentos ledos del archivo.
+            size_type synchronous_loads = 0;    // Lecturas que el consumidor tuvo que esperar completas.
+        };
+
+    // Tipos miembro privados
+    private:
+        /// Un fragmento de memoria, en memoria o en el archivo.
+        struct chunk
+        {
+            pointer elements = nullptr;     // Los elementos, o nullptr si estn en el archivo.
+            off_t file_offset = -1;         // Posicin en el archivo, o -1 si no tiene.
+            std::future<void> loading;      // Lectura asncrona pendiente, si hay una.
+        };
+
+    // Atributos privados
+    private:
+        mySTL::deque<chunk*> chunks;        // El mapa de fragmentos, del primero al ltimo.
+        size_type chunk_elements;           // La cantidad de elementos de cada fragmento.
+        size_type max_resident_chunks;      // Fragmentos que caben en el presupuesto de memoria.
+        size_type prefetch_chunks;          // Fragmentos que se leen por adelantado.
+        size_type resident_chunks;          // Fragmentos en memoria, incluidos los que se estn leyendo.
+        size_type head_index;               // ndice del primer elemento en el primer fragmento.
+        size_type tail_count;               // Cantidad de elementos en el ltimo fragmento.
+        size_type count;                    // La cantidad de elementos.
+
+        std::string spill_directory;        // Directorio del archivo temporal.
+        int file;                           // Descriptor del archivo, o -1 si no se ha creado.
+        off_t file_size;                    // Tamao usado del archivo.
+        mySTL::vector<off_t> free_slots;    // Posiciones del archivo que se pueden reutilizar.
+        spill_statistics statistics;        // Contadores de escrituras y lecturas.
+
+    // Mtodos pblicos
+    public:
+        /**
+         * Construye una cola vaca.
+         *
+         * @param memory_budget     La cantidad de bytes de elementos que se mantienen en memoria.
+         * Siempre se permiten al menos dos fragmentos (el primero y el ltimo).
+         * @param spill_directory   El directorio donde se crea el archivo temporal.
+         * @param chunk_bytes       El tamao aproximado de cada fragmento, en bytes.
+         * @param prefetch_chunks   La cantidad de fragmentos que se leen por adelantado.
+         */
+        explicit spilling_deque(size_type memory_budget,
+            const std::string& spill_directory = "/tmp",
+            size_type chunk_bytes = 64 * 1024, size_type prefetch_chunks = 1)
+            : chunks()
+            , chunk_elements(mySTL::max(size_type(1), chunk_bytes / sizeof(value_type)))
+            , max_resident_chunks(0)
+            , prefetch_chunks(prefetch_chunks)
+            , resident_chunks(0)
+            , head_index(0)
+            , tail_count(0)
+            , count(0)
+            , spill_directory(spill_directory)
+            , file(-1)
+            , file_size(0)
+            , free_slots()
+            , statistics()
+        {
+            this->max_resident_chunks = mySTL::max(size_type(2),
+                memory_budget / (this->chunk_elements * sizeof(value_type)));
+        }
+
+        // La cola es duea de un archivo y de lecturas pendientes, as que no se copia.
+        spilling_deque(const spilling_deque&) = delete;
+        spilling_deque& operator=(const spilling_deque&) = delete;
+
+        /**
+         * Destructor.
+         *
+         * Espera las lecturas pendientes, libera los fragmentos y cierra el archivo.
+         */
+        ~spilling_deque()
+        {
+            for (auto iteration = this->chunks.begin(); iteration != this->chunks.end(); ++iteration)
+            {
+                if ((*iteration)->loading.valid())
+                    (*iteration)->loading.wait();
+                delete [] (*iteration)->elements;
+                delete *iteration;
+            }
+
+            if (this->file != -1)
+                ::close(this->file);
+        }
+
+        // Capacidad.
+
+        /// Retorna la cantidad de elementos del contenedor.
+        inline size_type size() const noexcept { return this->count; }
+
+        /// Verifica si el contenedor est vaco.
+        inline bool empty() const noexcept { return (this->count == 0); }
+
+        /// Retorna la cantidad de fragmentos en memoria.
+        inline size_type resident_chunk_count() const noexcept { return this->resident_chunks; }
+
+        /// Retorna la cantidad de fragmentos que estn en el archivo.
+        inline size_type spilled_chunk_count() const noexcept
+        {
+            return this->chunks.size() - this->resident_chunks;
+        }
+
+        /// Retorna los contadores de escrituras y lecturas del archivo.
+        inline const spill_statistics& spill_stats() const noexcept { return this->statistics; }
+
+        // Acceso a elementos.
+
+        /// Retorna una referencia al primer elemento del contenedor.
+        inline reference front() { return this->chunks.front()->elements[this->head_index]; }
+
+        /// Retorna una referencia al ltimo elemento del contenedor.
+        inline reference back() { return this->chunks.back()->elements[this->tail_count - 1]; }
+
+        // Modificadores.
+
+        /**
+         * Agrega un elemento al final del contenedor. Si el ltimo fragmento est
+         * lleno, se crea uno nuevo y, si se supera el presupuesto de memoria,
+         * el fragmento lleno se escribe en el archivo.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push_back(const value_type& value)
+        {
+            if (this->chunks.empty() || this->tail_count == this->chunk_elements)
+            {
+                // El fragmento lleno deja de ser el ltimo. Si no es tambin el
+                // primero y no cabe en el presupuesto, escribirlo en el archivo.
+                if (this->chunks.size() >= 2 && this->resident_chunks >= this->max_resident_chunks)
+                    this->spill(*this->chunks.back());
+
+                chunk* new_chunk = new chunk();
+                new_chunk->elements = new value_type[ this->chunk_elements ];
+                this->chunks.push_back(new_chunk);
+                ++this->resident_chunks;
+                this->tail_count = 0;
+            }
+
+            this->chunks.back()->elements[this->tail_count++] = value;
+            ++this->count;
+        }
+
+        /**
+         * Elimina el primer elemento del contenedor. Si el primer fragmento queda
+         * vaco, se libera y el siguiente pasa a ser el primero; si estaba en el
+         * archivo, se termina de leer.
+         */
+        void pop_front()
+        {
+            ++this->head_index;
+            --this->count;
+
+            // Si era el nico fragmento, reutilizarlo cuando quede vaco.
+            if (this->chunks.size() == 1)
+            {
+                if (this->head_index == this->tail_count)
+                    this->head_index = this->tail_count = 0;
+            }
+            else if (this->head_index == this->chunk_elements)
+            {
+                chunk* old_head = this->chunks.front();
+                delete [] old_head->elements;
+                delete old_head;
+                --this->resident_chunks;
+                this->chunks.pop_front();
+                this->head_index = 0;
+
+                // El nuevo primer fragmento debe estar en memoria.
+                chunk& new_head = *this->chunks.front();
+                if (new_head.elements == nullptr)
+                {
+                    this->start_load(new_head);
+                    ++this->statistics.synchronous_loads;
+                }
+                this->finish_load(new_head);
+
+                // Leer por adelantado los fragmentos siguientes.
+                size_type last_prefetch = mySTL::min(this->prefetch_chunks + 1, this->chunks.size());
+                for (size_type index = 1; index < last_prefetch; ++index)
+                    if (this->chunks[index]->elements == nullptr)
+                        this->start_load(*this->chunks[index]);
+            }
+        }
+
+    // Mtodos privados
+    private:
+
+        /// Crea el archivo temporal, si no existe, y lo borra del directorio.
+        void open_file()
+        {
+            if (this->file != -1)
+                return;
+
+            std::string path = this->spill_directory + "/mystl_spill_XXXXXX";
+            this->file = ::mkstemp(&path[0]);
+            if (this->file == -1)
+                throw std::runtime_error("mySTL::spilling_deque::open_file");
+            ::unlink(path.c_str());
+        }
+
+        /**
+         * Escribe el fragmento @a target en el archivo y libera su memoria.
+         *
+         * @param target    Un fragmento lleno en memoria.
+         */
+        void spill(chunk& target)
+        {
+            this->open_file();
+
+            // Reutilizar una posicin liberada del archivo, si hay alguna.
+            if (!this->free_slots.empty())
+            {
+                target.file_offset = this->free_slots.back();
+                this->free_slots.pop_back();
+            }
+            else
+            {
+                target.file_offset = this->file_size;
+                this->file_size += off_t(this->chunk_elements * sizeof(value_type));
+            }
+
+            const char* source = reinterpret_cast<const char*>(target.elements);
+            size_type remaining = this->chunk_elements * sizeof(value_type);
+            off_t offset = target.file_offset;
+            while (remaining > 0)
+            {
+                ssize_t written = ::pwrite(this->file, source, remaining, offset);
+                if (written < 0 && errno == EINTR)
+                    continue;
+                if (written <= 0)
+                    throw std::runtime_error("mySTL::spilling_deque::spill");
+                source += written;
+                offset += written;
+                remaining -= size_type(written);
+            }
+
+            delete [] target.elements;
+            target.elements = nullptr;
+            --this->resident_chunks;
+            ++this->statistics.spills;
+        }
+
+        /**
+         * Asigna memoria al fragmento @a target y empieza a leerlo del archivo
+         * en otro hilo.
+         *
+         * @param target    Un fragmento que est en el archivo.
+         */
+        void start_load(chunk& target)
+        {
+            target.elements = new value_type[ this->chunk_elements ];
+            ++this->resident_chunks;
+            ++this->statistics.loads;
+
+            int file_descriptor = this->file;
+            char* destination = reinterpret_cast<char*>(target.elements);
+            size_type bytes = this->chunk_elements * sizeof(value_type);
+            off_t offset = target.file_offset;
+
+            target.loading = std::async(std::launch::async,
+                [file_descriptor, destination, bytes, offset]()
+                {
+                    size_type done = 0;
+                    while (done < bytes)
+                    {
+                        ssize_t read_bytes = ::pread(file_descriptor, destination + done,
+                            bytes - done, offset + off_t(done));
+                        if (read_bytes < 0 && errno == EINTR)
+                            continue;
+                        if (read_bytes <= 0)
+                            throw std::runtime_error("mySTL::spilling_deque::load");
+                        done += size_type(read_bytes);
+                    }
+                });
+        }
+
+        /**
+         * Espera a que termine la lectura del fragmento @a target, si hay una,
+         * y libera su posicin en el archivo.
+         *
+         * @param target    Un fragmento en memoria.
+         */
+        void finish_load(chunk& target)
+        {
+            if (target.loading.valid())
+                target.loading.get(); // Relanza el error de lectura, si lo hubo.
+
+            if (target.file_offset != -1)
+            {
+                this->free_slots.push_back(target.file_offset);
+                target.file_offset = -1;
+            }
+        }
+    };
+
+}
+
+#endif /* MY_SPILLING_DEQUE_H */
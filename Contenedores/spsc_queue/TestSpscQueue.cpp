@@ -0,0 +1,94 @@
+#include "TestSpscQueue.h"
+
+int testSpscQueue()
+{
+    std::cout << "Prueba de spsc_queue en un solo hilo:\n";
+
+    mySTL::spsc_queue<int> queue1(4);
+
+    for (int num = 1; num <= 5; ++num)
+        std::cout << "try_push(" << num << "): "
+                  << ( queue1.try_push(num) ? "aceptado" : "rechazado" ) << '\n'; // El 5 se rechaza.
+
+    int value = 0;
+    queue1.try_pop(value);
+    std::cout << "try_pop: " << value << '\n'; // 1
+    std::cout << "Size of queue1: " << queue1.size() << '\n'; // 3
+
+    int more_ints[] = { 10, 20, 30 };
+    std::cout << "push_n: " << queue1.push_n(more_ints, 3) << '\n'; // 1 (solo cabe uno)
+
+    int popped[8];
+    std::size_t popped_count = queue1.pop_n(popped, 8);
+    std::cout << "pop_n: [ ";
+    for (std::size_t index = 0; index < popped_count; ++index)
+        std::cout << popped[index] << ' ';
+    std::cout << "]\n\n"; // [ 2 3 4 10 ]
+
+    std::cout << "Prueba de spsc_queue entre dos hilos:\n";
+
+    const long long item_count = 1000000;
+    mySTL::spsc_queue<long long> queue2(1024);
+    long long sum = 0;
+
+    std::thread consumer([&]()
+    {
+        long long item = 0;
+        for (long long received = 0; received < item_count; )
+        {
+            if (queue2.try_pop(item))
+            {
+                sum += item;
+                ++received;
+            }
+            else
+                std::this_thread::yield();
+        }
+    });
+
+    for (long long item = 1; item <= item_count; )
+    {
+        if (queue2.try_push(item))
+            ++item;
+        else
+            std::this_thread::yield();
+    }
+
+    consumer.join();
+    std::cout << "Suma recibida: " << sum << '\n'; // 500000500000
+    std::cout << '\n';
+
+    std::cout << "Prueba de spsc_chunked_queue entre dos hilos:\n";
+
+    mySTL::spsc_chunked_queue<long long> queue3;
+    sum = 0;
+
+    std::thread chunked_consumer([&]()
+    {
+        long long items[64];
+        for (long long received = 0; received < item_count; )
+        {
+            std::size_t count = queue3.pop_n(items, 64);
+            if (count == 0)
+                std::this_thread::yield();
+            for (std::size_t index = 0; index < count; ++index)
+                sum += items[index];
+            received += count;
+        }
+    });
+
+    long long batch[100];
+    for (long long item = 1; item <= item_count; item += 100)
+    {
+        for (long long index = 0; index < 100; ++index)
+            batch[index] = item + index;
+        queue3.push_n(batch, 100);
+    }
+
+    chunked_consumer.join();
+    std::cout << "Suma recibida: " << sum << '\n'; // 500000500000
+    std::cout << "Vacia: " << ( queue3.empty() ? "si" : "no" ) << '\n'; // si
+    std::cout << '\n';
+
+    return 0;
+}
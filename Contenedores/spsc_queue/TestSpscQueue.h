@@ -0,0 +1,11 @@
+#ifndef TEST_SPSC_QUEUE_H
+#define TEST_SPSC_QUEUE_H
+
+#include "my_spsc_queue.h"
+
+#include <iostream>
+#include <thread>
+
+int testSpscQueue();
+
+#endif /* TEST_SPSC_QUEUE_H */
@@ -0,0 +1,502 @@
+#ifndef MY_SPSC_QUEUE_H
+#define MY_SPSC_QUEUE_H
+
+#include "../algorithm/my_algorithm.h"
+#include "../circular_buffer/my_circular_buffer.h"
+#include "../deque/my_deque.h"
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace mySTL
+{
+
+#ifndef MY_CACHE_LINE_SIZE
+#define MY_CACHE_LINE_SIZE 64
+#endif
+
+    /**
+     * @brief Cola acotada sin candados para un solo productor y un solo consumidor.
+     *
+     * Los elementos se guardan en un arreglo circular con capacidad potencia de dos.
+     * El productor solo escribe tail y el consumidor solo escribe head; cada uno guarda
+     * adems una copia del ndice del otro, que solo se vuelve a leer cuando la copia
+     * indica que la cola est llena (o vaca). Los ndices de cada hilo estn en
+     * lneas de cach separadas para que no se invaliden mutuamente.
+     *
+     * Solo un hilo puede llamar a los mtodos push y solo un hilo a los mtodos pop.
+     *
+     * @tparam ValueType El tipo de los elementos que contiene.
+     */
+    template <typename ValueType>
+    class spsc_queue
+    {
+    // Tipos miembro pblicos
+    public:
+        // Primer parmetro de plantilla.
+        typedef ValueType value_type;
+        // Tipo entero sin signo.
+        typedef std::size_t     size_type;
+        // Referencia.
+        typedef value_type& reference;
+        // Referencia constante.
+        typedef const value_type& const_reference;
+        // Puntero.
+        typedef value_type* pointer;
+
+    // Atributos privados
+    private:
+        // Datos que no cambian despus de la construccin.
+        alignas(MY_CACHE_LINE_SIZE) value_type* elements;   // Arreglo circular de elementos.
+        size_type mask;                                     // La capacidad del arreglo menos uno.
+        size_type max_count;                                // La cantidad mxima de elementos.
+
+        // Datos del consumidor.
+        alignas(MY_CACHE_LINE_SIZE) std::atomic<size_type> head;    // Posicin lgica del primer elemento.
+        size_type cached_tail;                                      // ltima posicin de tail leda por el consumidor.
+
+        // Datos del productor.
+        alignas(MY_CACHE_LINE_SIZE) std::atomic<size_type> tail;    // Posicin lgica siguiente al ltimo elemento.
+        size_type cached_head;                                      // ltima posicin de head leda por el productor.
+
+    // Mtodos pblicos
+    public:
+        // Constructores y destructor.
+
+        /**
+         * Construye una cola vaca con capacidad para @a capacity elementos.
+         * El arreglo interno se redondea a la siguiente potencia de dos.
+         *
+         * @param capacity  La cantidad mxima de elementos de la cola.
+         */
+        explicit spsc_queue(size_type capacity)
+            : elements(new value_type[ my_next_power_of_two(capacity) ])
+            , mask(my_next_power_of_two(capacity) - 1)
+            , max_count(capacity)
+            , head(0)
+            , cached_tail(0)
+            , tail(0)
+            , cached_head(0)
+        {
+        }
+
+        // La cola no se puede copiar ni mover mientras otros hilos la usan.
+        spsc_queue(const spsc_queue&) = delete;
+        spsc_queue& operator=(const spsc_queue&) = delete;
+
+        /**
+         * Destructor.
+         *
+         * Destruye el objeto contenedor.
+         */
+        ~spsc_queue()
+        {
+            delete [] this->elements;
+        }
+
+        // Capacidad.
+
+        /// Retorna la cantidad mxima de elementos que puede contener la cola.
+        inline size_type capacity() const noexcept { return this->max_count; }
+
+        /// Retorna la cantidad aproximada de elementos (exacta si ningn otro hilo usa la cola).
+        inline size_type size() const noexcept
+        {
+            // Leer head primero: solo puede avanzar hasta tail, as que el tail que se lee
+            // despus no es menor y la resta no se desborda.
+            size_type current_head = this->head.load(std::memory_order_acquire);
+            size_type current_tail = this->tail.load(std::memory_order_acquire);
+            return ( current_tail - current_head );
+        }
+
+        /// Verifica si la cola est vaca (aproximado si otro hilo usa la cola).
+        inline bool empty() const noexcept { return (size() == 0); }
+
+        // Productor.
+
+        /**
+         * Intenta agregar un elemento al final de la cola.
+         *
+         * @param value El valor del elemento por agregar.
+         * @return TRUE si el elemento se agreg; FALSE si la cola estaba llena.
+         */
+        bool try_push(const value_type& value)
+        {
+            return this->try_emplace(value);
+        }
+
+        /**
+         * Intenta agregar un elemento al final de la cola.
+         *
+         * @param value El valor del elemento por agregar.
+         * @return TRUE si el elemento se agreg; FALSE si la cola estaba llena.
+         */
+        bool try_push(value_type&& value)
+        {
+            return this->try_emplace(std::forward<value_type>(value));
+        }
+
+        /**
+         * Intenta construir e insertar un elemento al final de la cola.
+         *
+         * @param args  Argumentos para construir el nuevo elemento.
+         * @return TRUE si el elemento se agreg; FALSE si la cola estaba llena.
+         */
+        template <typename... Args>
+        bool try_emplace(Args&&... args)
+        {
+            // Solo el productor modifica tail.
+            const size_type current_tail = this->tail.load(std::memory_order_relaxed);
+
+            // Si segn la copia de head la cola est llena, volver a leer head.
+            if (current_tail - this->cached_head == this->max_count)
+            {
+                this->cached_head = this->head.load(std::memory_order_acquire);
+                if (current_tail - this->cached_head == this->max_count)
+                    return false;
+            }
+
+            this->elements[current_tail & this->mask] = value_type(std::forward<Args>(args)...);
+            // Publicar el elemento al consumidor.
+            this->tail.store(current_tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Agrega a la cola tantos elementos del rango que empieza en @a first
+         * como quepan, hasta @a count, y los publica de una sola vez.
+         *
+         * @param first Iterador a la posicin inicial de la secuencia por agregar.
+         * @param count El nmero de elementos por agregar.
+         * @return El nmero de elementos que se agregaron.
+         */
+        template <typename InputIterator>
+        size_type push_n(InputIterator first, size_type count)
+        {
+            const size_type current_tail = this->tail.load(std::memory_order_relaxed);
+
+            // Si segn la copia de head no caben los elementos, volver a leer head.
+            if (this->max_count - (current_tail - this->cached_head) < count)
+                this->cached_head = this->head.load(std::memory_order_acquire);
+
+            // Agregar solo los elementos que caben.
+            count = mySTL::min(count, this->max_count - (current_tail - this->cached_head));
+
+            for (size_type index = 0; index < count; ++index, ++first)
+                this->elements[(current_tail + index) & this->mask] = *first;
+
+            this->tail.store(current_tail + count, std::memory_order_release);
+            return count;
+        }
+
+        // Consumidor.
+
+        /**
+         * Intenta mover el primer elemento de la cola hacia @a value y eliminarlo.
+         *
+         * @param value Referencia donde se guarda el elemento.
+         * @return TRUE si se obtuvo un elemento; FALSE si la cola estaba vaca.
+         */
+        bool try_pop(value_type& value)
+        {
+            // Solo el consumidor modifica head.
+            const size_type current_head = this->head.load(std::memory_order_relaxed);
+
+            // Si segn la copia de tail la cola est vaca, volver a leer tail.
+            if (current_head == this->cached_tail)
+            {
+                this->cached_tail = this->tail.load(std::memory_order_acquire);
+                if (current_head == this->cached_tail)
+                    return false;
+            }
+
+            value = std::move(this->elements[current_head & this->mask]);
+            // Liberar el espacio para el productor.
+            this->head.store(current_head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Mueve hasta @a max_count elementos del inicio de la cola al rango que
+         * empieza en @a result y los elimina de una sola vez.
+         *
+         * @param result    Iterador a la posicin inicial de la secuencia destino.
+         * @param max_count El nmero mximo de elementos por mover.
+         * @return El nmero de elementos que se movieron.
+         */
+        template <typename OutputIterator>
+        size_type pop_n(OutputIterator result, size_type max_count)
+        {
+            const size_type current_head = this->head.load(std::memory_order_relaxed);
+
+            // Si segn la copia de tail no hay suficientes elementos, volver a leer tail.
+            if (this->cached_tail - current_head < max_count)
+                this->cached_tail = this->tail.load(std::memory_order_acquire);
+
+            size_type count = mySTL::min(max_count, this->cached_tail - current_head);
+
+            for (size_type index = 0; index < count; ++index, ++result)
+                *result = std::move(this->elements[(current_head + index) & this->mask]);
+
+            this->head.store(current_head + count, std::memory_order_release);
+            return count;
+        }
+    };
+
+    /**
+     * @brief Cola sin lmite y sin candados para un solo productor y un solo consumidor.
+     *
+     * Igual que el deque, guarda los elementos en fragmentos de memoria de tamao fijo,
+     * pero en lugar de un mapa los fragmentos forman una lista enlazada: el productor
+     * agrega un fragmento nuevo cuando el ltimo se llena y el consumidor destruye el
+     * primero cuando lo termina de leer.
+     *
+     * Solo un hilo puede llamar a los mtodos push y solo un hilo a los mtodos pop.
+     *
+     * @tparam ValueType El tipo de los elementos que contiene.
+     */
+    template <typename ValueType>
+    class spsc_chunked_queue
+    {
+    // Tipos miembro pblicos
+    public:
+        // Primer parmetro de plantilla.
+        typedef ValueType value_type;
+        // Tipo entero sin signo.
+        typedef std::size_t     size_type;
+        // Puntero.
+        typedef value_type* pointer;
+
+    // Tipos miembro privados
+    private:
+        /// Fragmento de memoria de la lista enlazada.
+        struct chunk
+        {
+            pointer elements;                   // Los elementos del fragmento.
+            std::atomic<size_type> written;     // Cantidad de elementos publicados por el productor.
+            size_type read;                     // Cantidad de elementos ledos por el consumidor.
+            std::atomic<chunk*> next;           // El fragmento siguiente, o nullptr.
+
+            chunk()
+                : elements(new value_type[ buffer_size() ])
+                , written(0)
+                , read(0)
+                , next(nullptr)
+            {
+            }
+
+            ~chunk()
+            {
+                delete [] this->elements;
+            }
+        };
+
+    // Atributos privados
+    private:
+        alignas(MY_CACHE_LINE_SIZE) chunk* head_chunk;  // Fragmento que lee el consumidor.
+        alignas(MY_CACHE_LINE_SIZE) chunk* tail_chunk;  // Fragmento que escribe el productor.
+
+    // Mtodos pblicos
+    public:
+        /// Construye una cola vaca con un fragmento de memoria.
+        spsc_chunked_queue()
+            : head_chunk(new chunk())
+            , tail_chunk(this->head_chunk)
+        {
+        }
+
+        // La cola no se puede copiar ni mover mientras otros hilos la usan.
+        spsc_chunked_queue(const spsc_chunked_queue&) = delete;
+        spsc_chunked_queue& operator=(const spsc_chunked_queue&) = delete;
+
+        /// Destruye todos los fragmentos de memoria.
+        ~spsc_chunked_queue()
+        {
+            while (this->head_chunk != nullptr)
+            {
+                chunk* next = this->head_chunk->next.load(std::memory_order_relaxed);
+                delete this->head_chunk;
+                this->head_chunk = next;
+            }
+        }
+
+        // Productor.
+
+        /**
+         * Agrega un elemento al final de la cola.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push(const value_type& value)
+        {
+            this->emplace(value);
+        }
+
+        /**
+         * Agrega un elemento al final de la cola.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push(value_type&& value)
+        {
+            this->emplace(std::forward<value_type>(value));
+        }
+
+        /**
+         * Construye e inserta un elemento al final de la cola.
+         *
+         * @param args  Argumentos para construir el nuevo elemento.
+         */
+        template <typename... Args>
+        void emplace(Args&&... args)
+        {
+            size_type written = this->writable_chunk();
+            this->tail_chunk->elements[written] = value_type(std::forward<Args>(args)...);
+            // Publicar el elemento al consumidor.
+            this->tail_chunk->written.store(written + 1, std::memory_order_release);
+        }
+
+        /**
+         * Agrega @a count elementos del rango que empieza en @a first, publicndolos
+         * una vez por fragmento de memoria.
+         *
+         * @param first Iterador a la posicin inicial de la secuencia por agregar.
+         * @param count El nmero de elementos por agregar.
+         */
+        template <typename InputIterator>
+        void push_n(InputIterator first, size_type count)
+        {
+            while (count > 0)
+            {
+                size_type written = this->writable_chunk();
+                // Llenar lo que quede del fragmento actual.
+                size_type segment = mySTL::min(count, buffer_size() - written);
+
+                for (size_type index = 0; index < segment; ++index, ++first)
+                    this->tail_chunk->elements[written + index] = *first;
+
+                this->tail_chunk->written.store(written + segment, std::memory_order_release);
+                count -= segment;
+            }
+        }
+
+        // Consumidor.
+
+        /**
+         * Intenta mover el primer elemento de la cola hacia @a value y eliminarlo.
+         *
+         * @param value Referencia donde se guarda el elemento.
+         * @return TRUE si se obtuvo un elemento; FALSE si la cola estaba vaca.
+         */
+        bool try_pop(value_type& value)
+        {
+            if (!this->readable_chunk())
+                return false;
+
+            value = std::move(this->head_chunk->elements[this->head_chunk->read++]);
+            return true;
+        }
+
+        /**
+         * Mueve hasta @a max_count elementos del inicio de la cola al rango que
+         * empieza en @a result, un fragmento de memoria a la vez.
+         *
+         * @param result    Iterador a la posicin inicial de la secuencia destino.
+         * @param max_count El nmero mximo de elementos por mover.
+         * @return El nmero de elementos que se movieron.
+         */
+        template <typename OutputIterator>
+        size_type pop_n(OutputIterator result, size_type max_count)
+        {
+            size_type count = 0;
+
+            while (count < max_count && this->readable_chunk())
+            {
+                chunk* current = this->head_chunk;
+                // Leer todo lo publicado en el fragmento actual.
+                size_type available = current->written.load(std::memory_order_acquire) - current->read;
+                size_type segment = mySTL::min(max_count - count, available);
+
+                for (size_type index = 0; index < segment; ++index, ++result)
+                    *result = std::move(current->elements[current->read + index]);
+
+                current->read += segment;
+                count += segment;
+            }
+            return count;
+        }
+
+        /// Verifica si la cola est vaca. Solo debe llamarlo el consumidor.
+        bool empty()
+        {
+            return !this->readable_chunk();
+        }
+
+    // Mtodos privados
+    private:
+
+        /**
+         * Retorna la cantidad de elementos que puede almacenar un fragmento de memoria.
+         *
+         * @return El nmero de elementos que almacena cada fragmento de memoria.
+         */
+        static size_type buffer_size() noexcept
+        {
+            // Mismo tamao de fragmento que el deque.
+            return my_deque_chunk_size( sizeof(value_type) );
+        }
+
+        /**
+         * Si el ltimo fragmento est lleno, enlaza uno nuevo. Solo la llama el productor.
+         *
+         * @return La cantidad de elementos ya escritos en el ltimo fragmento.
+         */
+        size_type writable_chunk()
+        {
+            size_type written = this->tail_chunk->written.load(std::memory_order_relaxed);
+
+            if (written == buffer_size())
+            {
+                chunk* new_chunk = new chunk();
+                // Publicar el nuevo fragmento al consumidor.
+                this->tail_chunk->next.store(new_chunk, std::memory_order_release);
+                this->tail_chunk = new_chunk;
+                written = 0;
+            }
+            return written;
+        }
+
+        /**
+         * Avanza al siguiente fragmento si el primero ya fue ledo por completo,
+         * destruyndolo. Solo la llama el consumidor.
+         *
+         * @return TRUE si hay al menos un elemento por leer.
+         */
+        bool readable_chunk()
+        {
+            while (true)
+            {
+                chunk* current = this->head_chunk;
+
+                if (current->read < current->written.load(std::memory_order_acquire))
+                    return true;
+
+                // Si el fragmento no se ha llenado, el productor todava escribe en l.
+                if (current->read < buffer_size())
+                    return false;
+
+                chunk* next = current->next.load(std::memory_order_acquire);
+                if (next == nullptr)
+                    return false;
+
+                // El productor ya no usa este fragmento; destruirlo.
+                this->head_chunk = next;
+                delete current;
+            }
+        }
+    };
+
+}
+
+#endif /* MY_SPSC_QUEUE_H */
@@ -0,0 +1,27 @@
+#include "TestStack.h"
+
+int testStack()
+{
+    std::cout << "Prueba de stack:\n";
+
+    mySTL::stack<std::string> stack1;
+    stack1.push("uno");
+    stack1.push("dos");
+    stack1.emplace(3, 't');
+
+    std::cout << "top: " << stack1.top() << ", size: " << stack1.size() << '\n'; // top: ttt, size: 3
+
+    std::cout << "[ ";
+    while (!stack1.empty())
+    {
+        std::cout << stack1.top() << ' ';
+        stack1.pop();
+    }
+    std::cout << "]\n"; // [ ttt dos uno ]
+
+    mySTL::stack<std::string> stack2;
+    stack2.push("uno");
+    std::cout << "stack1 != stack2: " << ( stack1 != stack2 ? "si" : "no" ) << "\n\n"; // si
+
+    return 0;
+}
@@ -0,0 +1,11 @@
+#ifndef TEST_STACK_H
+#define TEST_STACK_H
+
+#include "my_stack.h"
+
+#include <iostream>
+#include <string>
+
+int testStack();
+
+#endif /* TEST_STACK_H */
@@ -0,0 +1,141 @@
+#ifndef MY_STACK_H
+#define MY_STACK_H
+
+#include "../deque/my_deque.h"
+
+#include <utility>
+
+namespace mySTL
+{
+    /**
+     * @brief Adaptador de contenedor que ofrece una pila LIFO: los elementos se
+     * agregan y se eliminan del mismo extremo.
+     *
+     * @tparam ValueType    El tipo de los elementos que contiene.
+     * @tparam Container    El contenedor subyacente. Debe ofrecer back, push_back,
+     * emplace_back, pop_back, size y empty.
+     */
+    template <typename ValueType, typename Container = mySTL::deque<ValueType>>
+    class stack
+    {
+    // Tipos miembro pblicos
+    public:
+        // Segundo parmetro de plantilla.
+        typedef Container container_type;
+        // Primer parmetro de plantilla.
+        typedef typename Container::value_type value_type;
+        // Tipo entero sin signo.
+        typedef typename Container::size_type size_type;
+        // Referencia.
+        typedef typename Container::reference reference;
+        // Referencia constante.
+        typedef typename Container::const_reference const_reference;
+
+    // Atributos protegidos
+    protected:
+        container_type container; // El contenedor subyacente.
+
+    // Mtodos pblicos
+    public:
+        /// Construye una pila vaca.
+        stack()
+            : container()
+        {
+        }
+
+        /**
+         * Construye la pila con una copia de los elementos de @a container. El ltimo
+         * elemento del contenedor queda en el tope.
+         *
+         * @param container El contenedor con los elementos iniciales.
+         */
+        explicit stack(const container_type& container)
+            : container(container)
+        {
+        }
+
+        /**
+         * Construye la pila con los elementos de @a container, sin copiarlos.
+         *
+         * @param container El contenedor con los elementos iniciales.
+         */
+        explicit stack(container_type&& container)
+            : container(std::move(container))
+        {
+        }
+
+        // Capacidad.
+
+        /// Verifica si la pila est vaca.
+        inline bool empty() const { return this->container.empty(); }
+
+        /// Retorna la cantidad de elementos en la pila.
+        inline size_type size() const { return this->container.size(); }
+
+        // Acceso a elementos.
+
+        /// Retorna una referencia al elemento en el tope de la pila.
+        inline reference top() { return this->container.back(); }
+        /// Retorna una referencia al elemento en el tope de la pila.
+        inline const_reference top() const { return this->container.back(); }
+
+        // Modificadores.
+
+        /**
+         * Agrega un elemento al tope de la pila.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push(const value_type& value) { this->container.push_back(value); }
+
+        /**
+         * Agrega un elemento al tope de la pila.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push(value_type&& value) { this->container.push_back(std::move(value)); }
+
+        /**
+         * Construye un elemento en el tope de la pila.
+         *
+         * @param args  Argumentos para construir el nuevo elemento.
+         */
+        template <typename... Args>
+        void emplace(Args&&... args) { this->container.emplace_back(std::forward<Args>(args)...); }
+
+        /// Elimina el elemento en el tope de la pila. La pila no debe estar vaca.
+        void pop() { this->container.pop_back(); }
+
+        /**
+         * Intercambia el contenido de esta pila por el de @a other.
+         *
+         * @param other Otra pila del mismo tipo.
+         */
+        void swap(stack& other)
+        {
+            this->container.swap(other.container);
+        }
+
+        template <typename V, typename C>
+        friend bool operator==(const stack<V, C>& lhs, const stack<V, C>& rhs);
+    };
+
+    // Funciones no miembros.
+
+    // Operadores relacionales
+
+    template <typename ValueType, typename Container>
+    inline bool operator==(const stack<ValueType, Container>& lhs, const stack<ValueType, Container>& rhs)
+    {
+        return lhs.container == rhs.container;
+    }
+
+    template <typename ValueType, typename Container>
+    inline bool operator!=(const stack<ValueType, Container>& lhs, const stack<ValueType, Container>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+}
+
+#endif /* MY_STACK_H */
@@ -0,0 +1,89 @@
+#include "TestTieredVector.h"
+
+/// Imprime un tiered_vector con formato.
+template <typename ValueType>
+void print_tiered_vector(const mySTL::tiered_vector<ValueType>& my_vector)
+{
+    std::cout << "[ ";
+    for (auto iteration = my_vector.begin(); iteration != my_vector.end(); ++iteration)
+        std::cout << *iteration << ( (iteration + 1 != my_vector.end()) ? ", " : " " );
+    std::cout << "]\n";
+}
+
+int testTieredVector()
+{
+    std::cout << "Prueba de insert y erase en medio:\n";
+
+    mySTL::tiered_vector<int> vector1 = { 1, 2, 3, 4, 5 };
+    vector1.insert(vector1.begin() + 2, 30);
+    vector1.insert(vector1.begin() + 4, 3, 0);
+    std::cout << "vector1: ";
+    print_tiered_vector(vector1); // [ 1, 2, 30, 3, 0, 0, 0, 4, 5 ]
+
+    vector1.erase(vector1.begin() + 1);
+    vector1.erase(vector1.begin() + 3, vector1.begin() + 6);
+    std::cout << "vector1: ";
+    print_tiered_vector(vector1); // [ 1, 30, 3, 4, 5 ]
+
+    vector1.push_front(0);
+    vector1.pop_back();
+    std::cout << "vector1: ";
+    print_tiered_vector(vector1); // [ 0, 1, 30, 3, 4 ]
+    std::cout << "at(2): " << vector1.at(2) << ", front: " << vector1.front()
+              << ", back: " << vector1.back() << '\n'; // 30, 0, 4
+
+    try
+    {
+        vector1.at(10);
+    }
+    catch (const std::out_of_range& exception)
+    {
+        std::cout << "Excepcion: " << exception.what() << '\n'; // mySTL::tiered_vector::at
+    }
+    std::cout << '\n';
+
+    std::cout << "Prueba de insercion en medio con varios fragmentos:\n";
+
+    // Insertar siempre en la mitad hace crecer la capacidad de los fragmentos.
+    mySTL::tiered_vector<int> vector2;
+    mySTL::vector<int> reference;
+
+    for (int num = 0; num < 5000; ++num)
+    {
+        vector2.insert(vector2.begin() + vector2.size() / 2, num);
+        reference.insert(reference.begin() + reference.size() / 2, num);
+    }
+    std::cout << "Size of vector2: " << vector2.size() << '\n'; // 5000
+    std::cout << "Capacidad de fragmento: " << vector2.tier_capacity() << '\n'; // 64
+
+    // Eliminar desde distintas posiciones.
+    for (int num = 0; num < 2000; ++num)
+    {
+        std::size_t index = (num * 7919) % vector2.size();
+        vector2.erase(vector2.begin() + index);
+        reference.erase(reference.begin() + index);
+    }
+
+    bool same = (vector2.size() == reference.size());
+    for (std::size_t index = 0; same && index < vector2.size(); ++index)
+        same = (vector2[index] == reference[index]);
+    std::cout << "Igual al vector: " << ( same ? "si" : "no" ) << '\n'; // si
+    std::cout << '\n';
+
+    std::cout << "Prueba de copia y comparacion:\n";
+
+    mySTL::tiered_vector<std::string> vector3 = { "uno", "dos", "tres" };
+    mySTL::tiered_vector<std::string> vector4(vector3);
+    vector4.insert(vector4.begin() + 1, "uno y medio");
+    std::cout << "vector4: ";
+    print_tiered_vector(vector4); // [ uno, uno y medio, dos, tres ]
+    std::cout << "vector3 == vector4: " << ( (vector3 == vector4) ? "si" : "no" ) << '\n'; // no
+    vector4.erase(vector4.begin() + 1);
+    std::cout << "vector3 == vector4: " << ( (vector3 == vector4) ? "si" : "no" ) << '\n'; // si
+
+    vector4.clear();
+    std::cout << "Vacio: " << ( vector4.empty() ? "si" : "no" ) << '\n'; // si
+    std::cout << '\n';
+
+    return 0;
+}
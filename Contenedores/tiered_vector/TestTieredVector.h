@@ -0,0 +1,12 @@
+#ifndef TEST_TIERED_VECTOR_H
+#define TEST_TIERED_VECTOR_H
+
+#include "my_tiered_vector.h"
+#include "../vector/my_vector.h"
+
+#include <iostream>
+#include <string>
+
+int testTieredVector();
+
+#endif /* TEST_TIERED_VECTOR_H */
@@ -0,0 +1 @@
+#include "my_tiered_vector.h"
\ No newline at end of file
@@ -0,0 +1,916 @@
+#ifndef MY_TIERED_VECTOR_H
+#define MY_TIERED_VECTOR_H
+
+#include "../algorithm/my_algorithm.h"
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace mySTL
+{
+    /**
+     * @brief Fragmento de memoria de un tiered_vector: un arreglo circular de
+     * capacidad fija (potencia de dos) y la posicin de su primer elemento.
+     */
+    template <typename ValueType>
+    struct my_tier
+    {
+        ValueType* elements;    // El arreglo circular del fragmento.
+        std::size_t head;       // Posicin en el arreglo del primer elemento del fragmento.
+    };
+
+    /**
+     * @brief tiered_vector::iterator. Guarda un puntero al mapa de fragmentos
+     * y el ndice del elemento; el fragmento y la posicin dentro de l se
+     * calculan con desplazamientos y mscaras al acceder al elemento.
+     *
+     * @tparam ValueType    El tipo de los elementos del contenedor
+     * (const para el iterador constante).
+     */
+    template <typename ValueType>
+    struct my_tiered_vector_iterator
+    {
+        // Identifica este struct como un iterador de acceso aleatorio.
+        typedef std::random_access_iterator_tag iterator_category;
+        // Primer parmetro de plantilla, sin calificador const.
+        typedef std::remove_cv_t<ValueType> value_type;
+        // Tipo entero sin signo.
+        typedef std::size_t     size_type;
+        // Tipo entero con signo.
+        typedef std::ptrdiff_t  difference_type;
+        // Referencia.
+        typedef ValueType&      reference;
+        // Puntero.
+        typedef ValueType*      pointer;
+        // Puntero a un fragmento del mapa.
+        typedef const my_tier<value_type>* map_pointer;
+        // Nombre del struct.
+        typedef my_tiered_vector_iterator self;
+
+        map_pointer map;    // Puntero al mapa de fragmentos del contenedor.
+        size_type shift;    // Logaritmo base dos de la capacidad de cada fragmento.
+        size_type index;    // ndice del elemento en el contenedor.
+
+        /// Constructor por defecto.
+        my_tiered_vector_iterator() noexcept
+            : map(nullptr)
+            , shift(0)
+            , index(0)
+        {
+        }
+
+        /// Construye un iterador que apunta al elemento @a index del mapa @a map.
+        my_tiered_vector_iterator(map_pointer map, size_type shift, size_type index) noexcept
+            : map(map)
+            , shift(shift)
+            , index(index)
+        {
+        }
+
+        /// Convierte un iterador en un iterador constante.
+        template <typename OtherType,
+                  typename = std::enable_if_t<std::is_same_v<const OtherType, ValueType>>>
+        my_tiered_vector_iterator(const my_tiered_vector_iterator<OtherType>& other) noexcept
+            : map(other.map)
+            , shift(other.shift)
+            , index(other.index)
+        {
+        }
+
+        // Sobrecarga de operadores.
+
+        /// Retorna el elemento al que apunta el iterador.
+        reference operator*() const noexcept
+        {
+            const my_tier<value_type>& tier = map[index >> shift];
+            return tier.elements[(tier.head + index) & ((size_type(1) << shift) - 1)];
+        }
+        /// Retorna un puntero al elemento al que apunta el iterador.
+        pointer operator->() const noexcept { return &(operator*()); }
+        /// Retorna el elemento en la posicin actual + @a count.
+        reference operator[](difference_type count) const noexcept { return *(*this + count); }
+
+        /// Operador de incremento prefijo.
+        self& operator++() noexcept { ++index; return *this; }
+        /// Operador de incremento postfijo.
+        self operator++(int) noexcept { self temp = *this; ++index; return temp; }
+        /// Operador de disminucin prefijo.
+        self& operator--() noexcept { --index; return *this; }
+        /// Operador de disminucin postfijo.
+        self operator--(int) noexcept { self temp = *this; --index; return temp; }
+
+        /// Operador de suma-asignacin.
+        self& operator+=(difference_type count) noexcept { index += count; return *this; }
+        /// Operador de resta-asignacin.
+        self& operator-=(difference_type count) noexcept { index -= count; return *this; }
+        /// Operador de suma.
+        self operator+(difference_type count) const noexcept { self temp = *this; return (temp += count); }
+        /// Operador de resta.
+        self operator-(difference_type count) const noexcept { self temp = *this; return (temp -= count); }
+
+        /// Distancia entre dos iteradores del mismo contenedor.
+        difference_type operator-(const self& other) const noexcept
+        {
+            return difference_type(index - other.index);
+        }
+
+        // Operadores relacionales. Los iteradores deben ser del mismo contenedor.
+
+        bool operator==(const self& other) const noexcept { return (index == other.index); }
+        bool operator!=(const self& other) const noexcept { return !(*this == other); }
+        bool operator<(const self& other) const noexcept { return (index < other.index); }
+        bool operator>(const self& other) const noexcept { return (other < *this); }
+        bool operator<=(const self& other) const noexcept { return !(other < *this); }
+        bool operator>=(const self& other) const noexcept { return !(*this < other); }
+    };
+
+    /**
+     * @brief Contenedor secuencial con acceso aleatorio en tiempo constante e
+     * insercin y eliminacin en cualquier posicin en tiempo O(sqrt(n)).
+     *
+     * Igual que el deque, guarda los elementos en fragmentos de memoria de tamao
+     * fijo referenciados desde un mapa, pero cada fragmento es un pequeo arreglo
+     * circular. Todos los fragmentos estn llenos excepto el ltimo, as que el
+     * fragmento de un elemento se obtiene con un desplazamiento de bits. Para
+     * insertar en medio, solo se desplazan los elementos de un fragmento; en los
+     * fragmentos siguientes basta con rotar un elemento de cada uno.
+     *
+     * La capacidad de los fragmentos (una potencia de dos) se duplica a medida que
+     * crece el contenedor, para mantenerla cerca de la raz cuadrada del tamao.
+     *
+     * @tparam ValueType El tipo de los elementos que contiene.
+     */
+    template <typename ValueType>
+    class tiered_vector
+    {
+    // Tipos miembro pblicos
+    public:
+        // Primer parmetro de plantilla.
+        typedef ValueType value_type;
+        // Tipo entero sin signo.
+        typedef std::size_t     size_type;
+        // Tipo entero con signo.
+        typedef std::ptrdiff_t  difference_type;
+        // Referencia.
+        typedef value_type& reference;
+        // Referencia constante.
+        typedef const value_type& const_reference;
+        // Puntero.
+        typedef value_type* pointer;
+        // Puntero constante.
+        typedef const value_type* const_pointer;
+        // Iterador.
+        typedef my_tiered_vector_iterator<value_type> iterator;
+        // Iterador constante.
+        typedef my_tiered_vector_iterator<const value_type> const_iterator;
+        // Iterador inverso.
+        typedef std::reverse_iterator<iterator> reverse_iterator;
+        // Iterador inverso constante.
+        typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    // Tipos miembro privados
+    private:
+        // Fragmento de memoria.
+        typedef my_tier<value_type> tier_type;
+
+        // Logaritmo base dos de la capacidad inicial de los fragmentos (16 elementos).
+        static constexpr size_type initial_shift = 4;
+
+    // Atributos privados
+    private:
+        tier_type* map;             // Arreglo de fragmentos. Solo los primeros allocated tienen memoria.
+        size_type map_size;         // Cantidad de fragmentos que caben en el mapa.
+        size_type allocated;        // Cantidad de fragmentos con memoria asignada.
+        size_type shift;            // Logaritmo base dos de la capacidad de cada fragmento.
+        size_type count;            // Cantidad de elementos del contenedor.
+
+    // Mtodos pblicos
+    public:
+        // Constructores y destructor.
+
+        /**
+         * Constructor por defecto.
+         *
+         * Construye un contenedor vaco, sin elementos.
+         */
+        tiered_vector()
+            : map(nullptr)
+            , map_size(0)
+            , allocated(0)
+            , shift(initial_shift)
+            , count(0)
+        {
+        }
+
+        /**
+         * Constructor de llenado.
+         *
+         * Construye un contenedor con @a count elementos. Cada elemento es una copia de @a value.
+         *
+         * @param count El tamao inicial del contenedor.
+         * @param value Valor para llenar el contenedor.
+         */
+        explicit tiered_vector(size_type count, const value_type& value = value_type())
+            : tiered_vector()
+        {
+            this->shift = tier_shift_for(count);
+            for (size_type index = 0; index < count; ++index)
+                this->push_back(value);
+        }
+
+        /**
+         * Constructor de rango.
+         *
+         * Construye un contenedor con tantos elementos como el rango [@a first, @a last),
+         * con cada elemento construido a partir de su elemento correspondiente en ese rango,
+         * en el mismo orden.
+         *
+         * @param first, last   Iteradores de entrada a las posiciones inicial y final en un rango.
+         */
+        template <typename InputIterator,
+                  typename = typename std::enable_if_t<std::is_base_of_v<std::input_iterator_tag,
+                    typename std::iterator_traits<InputIterator>::iterator_category>>>
+        tiered_vector(InputIterator first, InputIterator last)
+            : tiered_vector()
+        {
+            for (; first != last; ++first)
+                this->push_back(*first);
+        }
+
+        /**
+         * Constructor de copia.
+         *
+         * Construye el contenedor con una copia de cada uno de los elementos de @a other,
+         * en el mismo orden.
+         *
+         * @param other Otro objeto tiered_vector del mismo tipo, para inicializar el contenedor.
+         */
+        tiered_vector(const tiered_vector& other)
+            : tiered_vector()
+        {
+            this->shift = other.shift;
+            for (const_iterator current = other.begin(); current != other.end(); ++current)
+                this->push_back(*current);
+        }
+
+        /**
+         * Constructor de movimiento.
+         *
+         * Construye un contenedor que adquiere los elementos de @a temp, con semnticas de movimiento.
+         *
+         * @param temp  Otro objeto tiered_vector del mismo tipo, para inicializar el contenedor.
+         */
+        tiered_vector(tiered_vector&& temp)
+            : tiered_vector()
+        {
+            this->swap(temp);
+        }
+
+        /**
+         * Constructor con lista de inicializacin.
+         *
+         * Construye un contenedor con una copia de cada uno de los elementos de @a init_list,
+         * en el mismo orden.
+         *
+         * @param init_list Un objeto initializer_list.
+         */
+        tiered_vector(std::initializer_list<value_type> init_list)
+            : tiered_vector(init_list.begin(), init_list.end())
+        {
+        }
+
+        /**
+         * Destructor.
+         *
+         * Destruye el objeto contenedor.
+         */
+        ~tiered_vector()
+        {
+            this->destroy_tiers();
+        }
+
+        // Operador de asignacin.
+
+        /**
+         * Asignacin por copia.
+         *
+         * Reemplaza el contenido del contenedor por una copia del contenido de @a other.
+         *
+         * @param other Otro objeto tiered_vector del mismo tipo.
+         * @return *this.
+         */
+        tiered_vector& operator=(const tiered_vector& other)
+        {
+            auto temp_copy = tiered_vector(other);
+            this->swap(temp_copy);
+            return *this;
+        }
+
+        /**
+         * Asignacin por movimiento.
+         *
+         * Reemplaza el contenido del contenedor al mover dentro de este el contenido de @a temp.
+         *
+         * @param temp  Otro objeto tiered_vector del mismo tipo.
+         * @return *this.
+         */
+        tiered_vector& operator=(tiered_vector&& temp)
+        {
+            this->swap(temp);
+            return *this;
+        }
+
+        // Iteradores.
+
+        /// Retorna un iterador al principio.
+        inline iterator begin() noexcept { return iterator(this->map, this->shift, 0); }
+        /// Retorna un iterador al principio.
+        inline const_iterator begin() const noexcept { return const_iterator(this->map, this->shift, 0); }
+        /// Retorna un iterador constante al principio.
+        inline const_iterator cbegin() const noexcept { return begin(); }
+
+        /// Retorna un iterador al final.
+        inline iterator end() noexcept { return iterator(this->map, this->shift, this->count); }
+        /// Retorna un iterador al final.
+        inline const_iterator end() const noexcept { return const_iterator(this->map, this->shift, this->count); }
+        /// Retorna un iterador constante al final.
+        inline const_iterator cend() const noexcept { return end(); }
+
+        /// Retorna un iterador inverso al principio del contenedor invertido.
+        inline reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+        /// Retorna un iterador inverso al principio del contenedor invertido.
+        inline const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+        /// Retorna un iterador inverso constante al principio del contenedor invertido.
+        inline const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+        /// Retorna un iterador inverso al final del contenedor invertido.
+        inline reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+        /// Retorna un iterador inverso al final del contenedor invertido.
+        inline const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+        /// Retorna un iterador inverso constante al final del contenedor invertido.
+        inline const_reverse_iterator crend() const noexcept { return rend(); }
+
+        // Capacidad.
+
+        /// Retorna la cantidad de elementos del contenedor.
+        inline size_type size() const noexcept { return this->count; }
+        /// Retorna la cantidad mxima de elementos que puede contener el contenedor.
+        inline size_type max_size() const noexcept { return size_type(-1) / sizeof(value_type); }
+        /// Verifica si el contenedor est vaco.
+        inline bool empty() const noexcept { return (this->count == 0); }
+        /// Retorna la capacidad actual de cada fragmento de memoria.
+        inline size_type tier_capacity() const noexcept { return size_type(1) << this->shift; }
+
+        // Acceso a elementos.
+
+        /**
+         * Retorna una referencia al elemento en la posicin @a index del contenedor.
+         *
+         * @param index Posicin de un elemento en el contenedor.
+         * @return El elemento en la posicin especificada.
+         */
+        inline reference operator[](size_type index)
+        {
+            return slot(this->map[index >> this->shift], index);
+        }
+
+        /**
+         * Retorna una referencia al elemento en la posicin @a index del contenedor.
+         *
+         * @param index Posicin de un elemento en el contenedor.
+         * @return El elemento en la posicin especificada.
+         */
+        inline const_reference operator[](size_type index) const
+        {
+            const tier_type& tier = this->map[index >> this->shift];
+            return tier.elements[(tier.head + index) & this->mask()];
+        }
+
+        /**
+         * Retorna una referencia al elemento en la posicin @a index del contenedor.
+         *
+         * Este mtodo verifica si @a index est dentro del lmite de elementos vlidos
+         * en el contenedor. Si no lo est, lanza una excepcin.
+         *
+         * @param index Posicin de un elemento en el contenedor.
+         * @throw std::out_of_range
+         * @return El elemento en la posicin especificada.
+         */
+        inline reference at(size_type index)
+        {
+            if (index >= size())
+                throw std::out_of_range("mySTL::tiered_vector::at");
+
+            return (*this)[index];
+        }
+
+        /**
+         * Retorna una referencia al elemento en la posicin @a index del contenedor.
+         *
+         * Este mtodo verifica si @a index est dentro del lmite de elementos vlidos
+         * en el contenedor. Si no lo est, lanza una excepcin.
+         *
+         * @param index Posicin de un elemento en el contenedor.
+         * @throw std::out_of_range
+         * @return El elemento en la posicin especificada.
+         */
+        inline const_reference at(size_type index) const
+        {
+            if (index >= size())
+                throw std::out_of_range("mySTL::tiered_vector::at");
+
+            return (*this)[index];
+        }
+
+        /// Retorna una referencia al primer elemento en el contenedor.
+        inline reference front() { return (*this)[0]; }
+        /// Retorna una referencia al primer elemento en el contenedor.
+        inline const_reference front() const { return (*this)[0]; }
+
+        /// Retorna una referencia al ltimo elemento en el contenedor.
+        inline reference back() { return (*this)[this->count - 1]; }
+        /// Retorna una referencia al ltimo elemento en el contenedor.
+        inline const_reference back() const { return (*this)[this->count - 1]; }
+
+        // Modificadores.
+
+        /**
+         * Agrega un nuevo elemento al final del contenedor.
+         *
+         * @param value El valor del elemento por agregar al contenedor.
+         */
+        void push_back(const value_type& value)
+        {
+            this->emplace_back(value);
+        }
+
+        /**
+         * Agrega un nuevo elemento al final del contenedor.
+         *
+         * @param value El valor del elemento por agregar al contenedor.
+         */
+        void push_back(value_type&& value)
+        {
+            this->emplace_back(std::forward<value_type>(value));
+        }
+
+        /**
+         * Construye e inserta un elemento al final del contenedor.
+         *
+         * @param args  Argumentos para construir el nuevo elemento.
+         */
+        template <typename... Args>
+        void emplace_back(Args&&... args)
+        {
+            this->reserve_one();
+            // El ltimo fragmento siempre tiene espacio despus de reserve_one.
+            slot(this->map[this->count >> this->shift], this->count) = value_type(std::forward<Args>(args)...);
+            ++this->count;
+        }
+
+        /**
+         * Elimina el ltimo elemento del contenedor y reduce su tamao.
+         */
+        void pop_back()
+        {
+            --this->count;
+        }
+
+        /**
+         * Agrega un nuevo elemento al inicio del contenedor.
+         *
+         * Como todos los fragmentos, excepto el ltimo, deben estar llenos, esto
+         * rota un elemento de cada fragmento: O(sqrt(n)).
+         *
+         * @param value El valor del elemento por agregar al contenedor.
+         */
+        void push_front(const value_type& value)
+        {
+            this->emplace(begin(), value);
+        }
+
+        /**
+         * Agrega un nuevo elemento al inicio del contenedor.
+         *
+         * @param value El valor del elemento por agregar al contenedor.
+         */
+        void push_front(value_type&& value)
+        {
+            this->emplace(begin(), std::forward<value_type>(value));
+        }
+
+        /**
+         * Elimina el primer elemento del contenedor y reduce su tamao. O(sqrt(n)).
+         */
+        void pop_front()
+        {
+            this->erase(begin());
+        }
+
+        /**
+         * Inserta un elemento nuevo en el contenedor en la posicin @a position.
+         *
+         * @param position  Posicin en el contenedor donde se inserta el nuevo elemento.
+         * @param value     Valor del elemento por insertar.
+         * @return Un iterador que apunta al nuevo elemento.
+         */
+        iterator insert(const_iterator position, const value_type& value)
+        {
+            return this->emplace(position, value);
+        }
+
+        /**
+         * Inserta un elemento nuevo en el contenedor en la posicin @a position.
+         *
+         * @param position  Posicin en el contenedor donde se inserta el nuevo elemento.
+         * @param value     Valor del elemento por insertar.
+         * @return Un iterador que apunta al nuevo elemento.
+         */
+        iterator insert(const_iterator position, value_type&& value)
+        {
+            return this->emplace(position, std::forward<value_type>(value));
+        }
+
+        /**
+         * Inserta @a count elementos nuevos en la posicin @a position. Cada elemento
+         * es una copia de @a value.
+         *
+         * Si son pocos elementos, se insertan uno por uno en O(sqrt(n)) cada uno; si son
+         * muchos, se agregan al final y se desplazan los elementos siguientes una sola vez.
+         *
+         * @param position  Posicin en el contenedor donde se insertan los nuevos elementos.
+         * @param count     Cantidad de elementos por insertar.
+         * @param value     Valor de los elementos por insertar.
+         * @return Un iterador que apunta al primero de los nuevos elementos.
+         */
+        iterator insert(const_iterator position, size_type count, const value_type& value)
+        {
+            size_type index = position.index;
+            size_type tail_count = this->count - index;
+
+            if (count == 0)
+                return begin() + index;
+
+            if (count * (this->tier_capacity() / 2 + this->used_tiers()) < tail_count + count)
+            {
+                for (size_type inserted = 0; inserted < count; ++inserted)
+                    this->emplace(begin() + index, value);
+            }
+            else
+            {
+                // Agregar count elementos al final, desplazar el rango [index, final)
+                // count posiciones y copiar value en el espacio que queda libre.
+                value_type copy = value;
+                for (size_type inserted = 0; inserted < count; ++inserted)
+                    this->emplace_back(copy);
+                for (size_type current = this->count - 1; current >= index + count; --current)
+                    (*this)[current] = std::move((*this)[current - count]);
+                for (size_type current = index; current < index + count; ++current)
+                    (*this)[current] = copy;
+            }
+
+            return begin() + index;
+        }
+
+        /**
+         * Inserta los elementos de la lista de inicializacin @a init_list en la posicin @a position.
+         *
+         * @param position  Posicin en el contenedor donde se insertan los nuevos elementos.
+         * @param init_list Un objeto initializer_list.
+         * @return Un iterador que apunta al primero de los nuevos elementos.
+         */
+        iterator insert(const_iterator position, std::initializer_list<value_type> init_list)
+        {
+            size_type index = position.index;
+            size_type offset = 0;
+            for (const value_type& value : init_list)
+                this->emplace(begin() + (index + offset++), value);
+            return begin() + index;
+        }
+
+        /**
+         * Construye e inserta un elemento nuevo en la posicin @a position. O(sqrt(n)).
+         *
+         * @param position  Posicin en el contenedor donde se inserta el nuevo elemento.
+         * @param args      Argumentos para construir el nuevo elemento.
+         * @return Un iterador que apunta al nuevo elemento.
+         */
+        template <typename... Args>
+        iterator emplace(const_iterator position, Args&&... args)
+        {
+            size_type index = position.index;
+
+            // Insertar al final no requiere desplazar nada.
+            if (index == this->count)
+            {
+                this->emplace_back(std::forward<Args>(args)...);
+                return begin() + index;
+            }
+
+            value_type carry = value_type(std::forward<Args>(args)...);
+            this->reserve_one();
+
+            size_type first_tier = index >> this->shift;
+            size_type last_tier = this->count >> this->shift;   // Fragmento que recibe el nuevo ltimo elemento.
+            size_type last_size = this->count & this->mask();    // Cantidad de elementos en ese fragmento.
+
+            if (first_tier == last_tier)
+                insert_in_tier(this->map[first_tier], last_size, index & this->mask(), carry);
+            else
+            {
+                // El fragmento de la posicin est lleno: su ltimo elemento pasa al siguiente.
+                carry = insert_in_full_tier(this->map[first_tier], index & this->mask(), carry);
+
+                // Los fragmentos intermedios, tambin llenos, rotan un elemento cada uno.
+                for (size_type tier = first_tier + 1; tier < last_tier; ++tier)
+                    carry = push_front_full_tier(this->map[tier], carry);
+
+                // El ltimo fragmento tiene espacio para un elemento ms al inicio.
+                tier_type& last = this->map[last_tier];
+                last.head = (last.head - 1) & this->mask();
+                last.elements[last.head] = std::move(carry);
+            }
+
+            ++this->count;
+            return begin() + index;
+        }
+
+        /**
+         * Elimina el elemento en la posicin @a position. O(sqrt(n)).
+         *
+         * @param position  Iterador que apunta al elemento por eliminar.
+         * @return Un iterador que apunta al elemento siguiente al eliminado.
+         */
+        iterator erase(const_iterator position)
+        {
+            size_type index = position.index;
+            size_type first_tier = index >> this->shift;
+            size_type last_tier = (this->count - 1) >> this->shift; // Fragmento del ltimo elemento.
+
+            if (first_tier == last_tier)
+                erase_in_tier(this->map[first_tier], this->count - (last_tier << this->shift), index & this->mask());
+            else
+            {
+                // Queda un espacio libre al final del fragmento de la posicin.
+                erase_in_tier(this->map[first_tier], this->tier_capacity(), index & this->mask());
+
+                // Llenar el final de cada fragmento con el primer elemento del siguiente.
+                for (size_type tier = first_tier + 1; tier <= last_tier; ++tier)
+                {
+                    tier_type& next = this->map[tier];
+                    slot(this->map[tier - 1], this->mask()) = std::move(next.elements[next.head]);
+                    next.head = (next.head + 1) & this->mask();
+                }
+            }
+
+            --this->count;
+            return begin() + index;
+        }
+
+        /**
+         * Elimina los elementos en el rango [@ first, @ last) del contenedor.
+         *
+         * Si son pocos elementos, se eliminan uno por uno en O(sqrt(n)) cada uno; si son
+         * muchos, se desplazan los elementos siguientes una sola vez.
+         *
+         * @param first, last   Rango de elementos a eliminar.
+         * @return iterador que apunta a la nueva ubicacin del elemento siguiente al ltimo eliminado.
+         */
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            size_type index = first.index;
+            size_type count = last.index - first.index;
+            size_type tail_count = this->count - last.index;
+
+            if (count * (this->tier_capacity() / 2 + this->used_tiers()) < tail_count + count)
+            {
+                for (size_type erased = 0; erased < count; ++erased)
+                    this->erase(begin() + index);
+            }
+            else
+            {
+                // Mover los elementos siguientes al rango a su nueva posicin.
+                for (size_type current = index; current + count < this->count; ++current)
+                    (*this)[current] = std::move((*this)[current + count]);
+                this->count -= count;
+            }
+
+            return begin() + index;
+        }
+
+        /**
+         * Intercambia el contenido de este objeto por el contenido de @a other.
+         *
+         * @param other Otro objeto tiered_vector del mismo tipo, para intercambiar sus elementos.
+         */
+        void swap(tiered_vector& other)
+        {
+            using std::swap; // Funcin swap de la biblioteca estndar.
+            swap(this->map, other.map);
+            swap(this->map_size, other.map_size);
+            swap(this->allocated, other.allocated);
+            swap(this->shift, other.shift);
+            swap(this->count, other.count);
+        }
+
+        /**
+         * Elimina todos los elementos del contenedor y libera sus fragmentos de memoria.
+         */
+        void clear() noexcept
+        {
+            this->destroy_tiers();
+            this->map = nullptr;
+            this->map_size = this->allocated = this->count = 0;
+            this->shift = initial_shift;
+        }
+
+    // Mtodos privados
+    private:
+
+        /// Retorna la capacidad de los fragmentos menos uno.
+        inline size_type mask() const noexcept { return this->tier_capacity() - 1; }
+
+        /// Retorna la cantidad de fragmentos que tienen elementos.
+        inline size_type used_tiers() const noexcept { return (this->count + this->mask()) >> this->shift; }
+
+        /// Retorna el elemento @a local (o @a index, pues solo cuentan sus bits bajos) de @a tier.
+        inline reference slot(tier_type& tier, size_type local) noexcept
+        {
+            return tier.elements[(tier.head + local) & this->mask()];
+        }
+
+        /**
+         * Retorna el logaritmo base dos de la capacidad de fragmento adecuada para
+         * @a count elementos: la menor potencia de dos C tal que count <= 2 * C * C.
+         */
+        static size_type tier_shift_for(size_type count) noexcept
+        {
+            size_type shift = initial_shift;
+            while (count > 2 * (size_type(1) << (2 * shift)))
+                ++shift;
+            return shift;
+        }
+
+        /**
+         * Prepara el contenedor para recibir un elemento ms: duplica la capacidad
+         * de los fragmentos si el contenedor creci demasiado, y asegura que el
+         * fragmento que recibe el nuevo ltimo elemento tenga memoria.
+         */
+        void reserve_one()
+        {
+            if (tier_shift_for(this->count + 1) > this->shift)
+                this->retier(this->shift + 1);
+
+            size_type tier = this->count >> this->shift;
+            if (tier < this->allocated)
+                return;
+
+            // Si el mapa est lleno, reasignarlo con el doble de capacidad.
+            if (tier == this->map_size)
+            {
+                size_type new_map_size = mySTL::max(size_type(8), this->map_size * 2);
+                tier_type* new_map = new tier_type[new_map_size];
+                for (size_type index = 0; index < this->allocated; ++index)
+                    new_map[index] = this->map[index];
+                delete [] this->map;
+                this->map = new_map;
+                this->map_size = new_map_size;
+            }
+
+            this->map[tier].elements = new value_type[this->tier_capacity()];
+            this->map[tier].head = 0;
+            ++this->allocated;
+        }
+
+        /**
+         * Redistribuye todos los elementos en fragmentos de capacidad 2^@a new_shift.
+         *
+         * @param new_shift Logaritmo base dos de la nueva capacidad de los fragmentos.
+         */
+        void retier(size_type new_shift)
+        {
+            tiered_vector temp;
+            temp.shift = new_shift;
+            for (size_type index = 0; index < this->count; ++index)
+                temp.push_back(std::move((*this)[index]));
+            this->swap(temp);
+        }
+
+        /// Libera todos los fragmentos de memoria y el mapa.
+        void destroy_tiers() noexcept
+        {
+            for (size_type index = 0; index < this->allocated; ++index)
+                delete [] this->map[index].elements;
+            delete [] this->map;
+        }
+
+        /**
+         * Inserta @a value en la posicin @a local de @a tier, que tiene @a size
+         * elementos y espacio para uno ms. Desplaza la mitad ms corta.
+         */
+        void insert_in_tier(tier_type& tier, size_type size, size_type local, value_type& value)
+        {
+            if (local < size / 2)
+            {
+                // Desplazar los primeros elementos una posicin hacia atrs.
+                tier.head = (tier.head - 1) & this->mask();
+                for (size_type index = 0; index < local; ++index)
+                    slot(tier, index) = std::move(slot(tier, index + 1));
+            }
+            else
+            {
+                // Desplazar los ltimos elementos una posicin hacia adelante.
+                for (size_type index = size; index > local; --index)
+                    slot(tier, index) = std::move(slot(tier, index - 1));
+            }
+
+            slot(tier, local) = std::move(value);
+        }
+
+        /**
+         * Inserta @a value en la posicin @a local de @a tier, que est lleno.
+         *
+         * @return El elemento que estaba al final de @a tier y ya no cabe.
+         */
+        value_type insert_in_full_tier(tier_type& tier, size_type local, value_type& value)
+        {
+            value_type last = std::move(slot(tier, this->mask()));
+
+            // Con el ltimo elemento fuera, el fragmento tiene espacio para uno ms.
+            insert_in_tier(tier, this->mask(), local, value);
+            return last;
+        }
+
+        /**
+         * Inserta @a value al inicio de @a tier, que est lleno, rotando su arreglo
+         * circular una posicin.
+         *
+         * @return El elemento que estaba al final de @a tier y ya no cabe.
+         */
+        value_type push_front_full_tier(tier_type& tier, value_type& value)
+        {
+            // La casilla anterior al primer elemento es la del ltimo.
+            tier.head = (tier.head - 1) & this->mask();
+            value_type last = std::move(tier.elements[tier.head]);
+            tier.elements[tier.head] = std::move(value);
+            return last;
+        }
+
+        /**
+         * Elimina el elemento en la posicin @a local de @a tier, que tiene @a size
+         * elementos, desplazando la mitad ms corta. El espacio libre queda al final.
+         */
+        void erase_in_tier(tier_type& tier, size_type size, size_type local)
+        {
+            if (local < size / 2)
+            {
+                // Desplazar los primeros elementos una posicin hacia adelante.
+                for (size_type index = local; index > 0; --index)
+                    slot(tier, index) = std::move(slot(tier, index - 1));
+                tier.head = (tier.head + 1) & this->mask();
+            }
+            else
+            {
+                // Desplazar los ltimos elementos una posicin hacia atrs.
+                for (size_type index = local; index + 1 < size; ++index)
+                    slot(tier, index) = std::move(slot(tier, index + 1));
+            }
+        }
+    };
+
+    // Funciones no miembros.
+
+    // Operadores relacionales
+
+    template <typename ValueType>
+    inline bool operator==(const tiered_vector<ValueType>& lhs, const tiered_vector<ValueType>& rhs)
+    {
+        return ( ( lhs.size() == rhs.size() ) && ( mySTL::equal(lhs.begin(), lhs.end(), rhs.begin()) ) );
+    }
+
+    template <typename ValueType>
+    inline bool operator!=(const tiered_vector<ValueType>& lhs, const tiered_vector<ValueType>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    // Funcin swap
+
+    /**
+    * Intercambia el contenido de @a vector_one por el de @a vector_two.
+    *
+    * @param vector_one, vector_two Contenedores tiered_vector del mismo tipo.
+    */
+    template <typename ValueType>
+    inline void swap(tiered_vector<ValueType>& vector_one, tiered_vector<ValueType>& vector_two)
+    {
+        vector_one.swap(vector_two);
+    }
+
+}
+
+#endif /* MY_TIERED_VECTOR_H */
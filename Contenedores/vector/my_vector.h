@@ -99,8 +99,7 @@ namespace mySTL
             , storage_capacity(this->count)
             , elements(new value_type[this->storage_capacity])
         {
-            for ( size_type index = 0; index < count; ++index )
-                this->construct_element(index, value);
+            mySTL::fill(begin(), end(), value);
         }
 
         /**
@@ -358,8 +357,7 @@ namespace mySTL
                     this->reallocate(count); // Reasignar el almacenamiento.
 
                 // Asignar los nuevos elementos con el valor value.
-                for (size_type index = size(); index < count; ++index)
-                    this->construct_element(index, value);
+                mySTL::fill(end(), begin() + count, value);
             }
             this->count = count; // count es la nueva cantidad de elementos.
         }
@@ -0,0 +1,182 @@
+#include "TestWorkStealing.h"
+
+namespace
+{
+    /// Calcula el nmero de Fibonacci de @a number creando una tarea por llamada.
+    long long parallel_fib(mySTL::thread_pool& pool, int number)
+    {
+        if (number < 2)
+            return number;
+
+        long long first = 0;
+        mySTL::task_group group(pool);
+        group.run([&]() { first = parallel_fib(pool, number - 1); });
+        long long second = parallel_fib(pool, number - 2);
+        group.wait();
+
+        return first + second;
+    }
+}
+
+int testWorkStealing()
+{
+    std::cout << "Prueba de work_stealing_deque en un solo hilo:\n";
+
+    mySTL::work_stealing_deque<int> deque1(2);
+
+    for (int num = 1; num <= 5; ++num)
+        deque1.push(num); // Crece de 2 a 8 elementos.
+
+    int value = 0;
+    deque1.pop(value);
+    std::cout << "pop: " << value << '\n'; // 5
+    deque1.steal(value);
+    std::cout << "steal: " << value << '\n'; // 1
+    std::cout << "Size of deque1: " << deque1.size() << '\n'; // 3
+    std::cout << '\n';
+
+    std::cout << "Prueba de work_stealing_deque con ladrones:\n";
+
+    const int item_count = 100000;
+    mySTL::work_stealing_deque<int> deque2;
+    std::atomic<long long> stolen_sum(0);
+    std::atomic<bool> done(false);
+    long long owner_sum = 0;
+
+    std::thread thieves[2];
+    for (std::thread& thief : thieves)
+        thief = std::thread([&]()
+        {
+            int item = 0;
+            while (!done.load() || !deque2.empty())
+            {
+                if (deque2.steal(item))
+                    stolen_sum += item;
+                else
+                    std::this_thread::yield();
+            }
+        });
+
+    for (int item = 1; item <= item_count; ++item)
+    {
+        deque2.push(item);
+        // Sacar la mitad de los elementos desde el dueo.
+        if (item % 2 == 0 && deque2.pop(value))
+            owner_sum += value;
+    }
+    while (deque2.pop(value))
+        owner_sum += value;
+
+    done.store(true);
+    for (std::thread& thief : thieves)
+        thief.join();
+
+    std::cout << "Suma total: " << owner_sum + stolen_sum.load() << '\n'; // 5000050000
+    std::cout << '\n';
+
+    std::cout << "Prueba de thread_pool:\n";
+
+    mySTL::thread_pool pool(4);
+    std::cout << "Hilos: " << pool.size() << '\n'; // 4
+    std::cout << "fib(20): " << parallel_fib(pool, 20) << '\n'; // 6765
+
+    std::atomic<int> counter(0);
+    {
+        mySTL::task_group group(pool);
+        for (int task = 0; task < 1000; ++task)
+            group.run([&]() { ++counter; });
+    } // El destructor de group espera a las tareas.
+    std::cout << "Tareas ejecutadas: " << counter.load() << '\n'; // 1000
+
+    // Una tarea que lanza una excepcin no detiene a las dems; wait la relanza al final.
+    counter = 0;
+    mySTL::task_group failing_group(pool);
+    for (int task = 0; task < 100; ++task)
+        failing_group.run([&counter, task]()
+        {
+            if (task == 50)
+                throw std::runtime_error("tarea 50");
+            ++counter;
+        });
+    try
+    {
+        failing_group.wait();
+        std::cout << "Sin excepcion\n";
+    }
+    catch (const std::runtime_error& error)
+    {
+        std::cout << "Excepcion: " << error.what() << '\n'; // Excepcion: tarea 50
+    }
+    std::cout << "Tareas sin excepcion: " << counter.load() << '\n'; // 99
+    std::cout << '\n';
+
+    std::cout << "Prueba de split_range y parallel_for_each:\n";
+
+    // 128 enteros por fragmento: 10000 elementos ocupan 79 fragmentos.
+    mySTL::deque<int> deque3;
+    for (int num = 0; num < 10000; ++num)
+        deque3.push_back(num);
+
+    auto deque_bounds = mySTL::split_range(deque3.begin(), deque3.end(), 4);
+    std::cout << "Subrangos: " << deque_bounds.size() - 1 << '\n'; // 4
+    bool aligned = true;
+    for (std::size_t part = 1; part + 1 < deque_bounds.size(); ++part)
+        aligned = aligned && ( deque_bounds[part].current == deque_bounds[part].first );
+    std::cout << "Limites al inicio de un fragmento: " << ( aligned ? "si" : "no" ) << '\n'; // si
+
+    mySTL::parallel_for_each(pool, deque3.begin(), deque3.end(), [](int& element) { element *= 2; });
+    std::cout << "deque3[9999]: " << deque3[9999] << '\n'; // 19998
+
+    mySTL::vector<long long> vector1(10000, 1);
+    mySTL::parallel_for_each(pool, vector1.begin(), vector1.end(), [](long long& element) { element += 1; });
+    long long vector_sum = 0;
+    for (long long element : vector1)
+        vector_sum += element;
+    std::cout << "Suma de vector1: " << vector_sum << '\n'; // 20000
+    std::cout << '\n';
+
+    std::cout << "Prueba de algoritmos con politicas de ejecucion:\n";
+
+    const auto policy = mySTL::execution::par.on(pool);
+    mySTL::vector<int> vector2(100000);
+    mySTL::fill(policy, vector2.begin(), vector2.end(), 3);
+    mySTL::transform(policy, vector2.begin(), vector2.end(), vector2.begin(), [](int element) { return element * 2; });
+    std::cout << "Suma: " << mySTL::reduce(policy, vector2.begin(), vector2.end(), 0LL) << '\n'; // 600000
+
+    mySTL::vector<int> vector3(100000);
+    mySTL::copy(policy, vector2.begin(), vector2.end(), vector3.begin());
+    std::cout << "Iguales: " << ( mySTL::equal(policy, vector2.begin(), vector2.end(), vector3.begin()) ? "si" : "no" ) << '\n'; // si
+    vector3[99999] = 7;
+    std::cout << "Iguales: " << ( mySTL::equal(mySTL::execution::seq, vector2.begin(), vector2.end(), vector3.begin()) ? "si" : "no" ) << '\n'; // no
+
+    mySTL::swap_ranges(policy, vector2.begin(), vector2.end(), vector3.begin());
+    std::cout << "Cantidad de 7: " << mySTL::count_if(policy, vector2.begin(), vector2.end(), [](int element) { return element == 7; }) << '\n'; // 1
+
+    std::atomic<long long> deque_sum(0);
+    mySTL::for_each(mySTL::execution::par_unseq.on(pool), deque3.begin(), deque3.end(), [&](int element) { deque_sum += element; });
+    std::cout << "Suma de deque3: " << deque_sum.load() << '\n'; // 99990000
+    std::cout << '\n';
+
+    std::cout << "Prueba de radix_sort:\n";
+
+    // Claves con signo, de mayor a menor.
+    mySTL::vector<int> vector4(100000);
+    for (int index = 0; index < 100000; ++index)
+        vector4[index] = 50000 - index;
+    mySTL::radix_sort(vector4.begin(), vector4.end());
+    std::cout << "Primero y ultimo: " << vector4.front() << ", " << vector4.back() << '\n'; // -49999, 50000
+
+    mySTL::radix_sort(policy, vector4.begin(), vector4.end(), [](int element) { return -element; });
+    std::cout << "Primero y ultimo: " << vector4.front() << ", " << vector4.back() << '\n'; // 50000, -49999
+
+    mySTL::vector<double> vector5;
+    for (double element : { 2.5, -1.0, 0.0, -7.25, 3.0 })
+        vector5.push_back(element);
+    mySTL::radix_sort(vector5.begin(), vector5.end());
+    std::cout << "Doubles: ";
+    for (double element : vector5)
+        std::cout << element << ' '; // -7.25 -1 0 2.5 3
+    std::cout << "\n\n";
+
+    return 0;
+}
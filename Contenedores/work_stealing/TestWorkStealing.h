@@ -0,0 +1,17 @@
+#ifndef TEST_WORK_STEALING_H
+#define TEST_WORK_STEALING_H
+
+#include "my_work_stealing_deque.h"
+#include "my_thread_pool.h"
+#include "my_parallel.h"
+#include "../algorithm/my_execution.h"
+#include "../algorithm/my_radix_sort.h"
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+int testWorkStealing();
+
+#endif /* TEST_WORK_STEALING_H */
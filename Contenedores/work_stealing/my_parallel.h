@@ -0,0 +1,206 @@
+#ifndef MY_PARALLEL_H
+#define MY_PARALLEL_H
+
+#include "my_thread_pool.h"
+#include "../deque/my_deque.h"
+#include "../vector/my_vector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#ifndef MY_CACHE_LINE_SIZE
+#define MY_CACHE_LINE_SIZE 64
+#endif
+
+namespace mySTL
+{
+    /**
+     * Divide el rango [first, last) en a lo sumo @a parts subrangos de tamao parecido,
+     * para iteradores de acceso aleatorio que no son punteros ni iteradores de deque.
+     *
+     * @param first, last   Iteradores a las posiciones inicial y final en un rango.
+     * @param parts         La cantidad deseada de subrangos.
+     * @return los lmites de los subrangos: el subrango k es [lmites[k], lmites[k + 1]).
+     * Siempre empieza con @a first y termina con @a last.
+     */
+    template <typename RandomAccessIterator>
+    mySTL::vector<RandomAccessIterator> split_range(RandomAccessIterator first, RandomAccessIterator last,
+        std::size_t parts)
+    {
+        mySTL::vector<RandomAccessIterator> bounds;
+        bounds.reserve(parts + 1);
+        bounds.push_back(first);
+
+        const std::size_t count = std::size_t(last - first);
+        std::size_t previous = 0;
+        for (std::size_t part = 1; part < parts; ++part)
+        {
+            const std::size_t offset = count * part / parts;
+            if (offset > previous && offset < count)
+            {
+                bounds.push_back(first + offset);
+                previous = offset;
+            }
+        }
+
+        bounds.push_back(last);
+        return bounds;
+    }
+
+    /**
+     * Divide el rango [first, last) de un arreglo contiguo en a lo sumo @a parts
+     * subrangos de tamao parecido. Cada lmite interno se mueve hacia adelante hasta
+     * el primer elemento que empieza en una lnea de cach, para que dos hilos que
+     * escriben en subrangos vecinos no compartan lneas de cach.
+     *
+     * @param first, last   Punteros a las posiciones inicial y final en un rango.
+     * @param parts         La cantidad deseada de subrangos.
+     * @return los lmites de los subrangos: el subrango k es [lmites[k], lmites[k + 1]).
+     * Siempre empieza con @a first y termina con @a last.
+     */
+    template <typename ValueType>
+    mySTL::vector<ValueType*> split_range(ValueType* first, ValueType* last, std::size_t parts)
+    {
+        mySTL::vector<ValueType*> bounds;
+        bounds.reserve(parts + 1);
+        bounds.push_back(first);
+
+        const std::size_t count = std::size_t(last - first);
+        for (std::size_t part = 1; part < parts; ++part)
+        {
+            ValueType* bound = first + count * part / parts;
+
+            // Avanzar hasta la siguiente lnea de cach.
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(bound);
+            const std::uintptr_t aligned = (address + MY_CACHE_LINE_SIZE - 1)
+                & ~std::uintptr_t(MY_CACHE_LINE_SIZE - 1);
+            bound += (aligned - address + sizeof(ValueType) - 1) / sizeof(ValueType);
+
+            if (bound < last && bound > bounds.back())
+                bounds.push_back(bound);
+        }
+
+        bounds.push_back(last);
+        return bounds;
+    }
+
+    /**
+     * Divide el rango [first, last) de un deque en a lo sumo @a parts subrangos de
+     * tamao parecido. Cada lmite interno es el inicio de un fragmento de memoria, de
+     * manera que cada subrango se recorre fragmento por fragmento sin compartir
+     * fragmentos con los dems. Los lmites se calculan movindose por el mapa, sin
+     * dividir por el tamao de los fragmentos en cada paso.
+     *
+     * @param first, last   Iteradores a las posiciones inicial y final en un rango.
+     * @param parts         La cantidad deseada de subrangos.
+     * @return los lmites de los subrangos: el subrango k es [lmites[k], lmites[k + 1]).
+     * Siempre empieza con @a first y termina con @a last.
+     */
+    template <typename ValueType>
+    mySTL::vector<my_deque_iterator<ValueType>> split_range(my_deque_iterator<ValueType> first,
+        my_deque_iterator<ValueType> last, std::size_t parts)
+    {
+        mySTL::vector<my_deque_iterator<ValueType>> bounds;
+        bounds.reserve(parts + 1);
+        bounds.push_back(first);
+
+        // Los lmites posibles son los inicios de los fragmentos despus del primero.
+        const std::size_t node_count = std::size_t(last.node - first.node);
+        for (std::size_t part = 1; part < parts; ++part)
+        {
+            const std::size_t offset = (node_count * part + parts / 2) / parts;
+            if (offset == 0 || offset > node_count || first.node + offset == bounds.back().node)
+                continue;
+
+            my_deque_iterator<ValueType> bound;
+            bound.set_node(first.node + offset);
+            bound.current = bound.first;
+            if (bound == last)
+                break;
+            bounds.push_back(bound);
+        }
+
+        bounds.push_back(last);
+        return bounds;
+    }
+
+    /**
+     * Aplica @a function a cada elemento de [first, last), en un solo hilo. Recorre
+     * el rango con un ciclo sobre punteros.
+     *
+     * @param first, last   Punteros a las posiciones inicial y final en un rango.
+     * @param function      Funcin que recibe una referencia a cada elemento.
+     */
+    template <typename ValueType, typename Function>
+    void sequential_for_each(ValueType* first, ValueType* last, Function& function)
+    {
+        for (; first != last; ++first)
+            function(*first);
+    }
+
+    /**
+     * Aplica @a function a cada elemento de [first, last) de un deque, en un solo
+     * hilo. Recorre cada fragmento de memoria con un ciclo sobre punteros, sin revisar
+     * el cambio de fragmento en cada elemento.
+     *
+     * @param first, last   Iteradores a las posiciones inicial y final en un rango.
+     * @param function      Funcin que recibe una referencia a cada elemento.
+     */
+    template <typename ValueType, typename Function>
+    void sequential_for_each(my_deque_iterator<ValueType> first, my_deque_iterator<ValueType> last,
+        Function& function)
+    {
+        while (first.node != last.node)
+        {
+            sequential_for_each(first.current, first.last, function);
+            first.set_node(first.node + 1);
+            first.current = first.first;
+        }
+        sequential_for_each(first.current, last.current, function);
+    }
+
+    /**
+     * Aplica @a function a cada elemento de [first, last) usando los hilos de @a pool.
+     *
+     * El rango se divide con split_range y cada subrango se ejecuta como una tarea.
+     * Se crean varias tareas por hilo para repartir mejor la carga si algunos
+     * elementos cuestan ms que otros. El hilo que llama tambin ejecuta tareas
+     * mientras espera.
+     *
+     * @param pool          El pool donde se ejecutan las tareas.
+     * @param first, last   Punteros o iteradores de deque a las posiciones inicial
+     * y final en un rango.
+     * @param function      Funcin que recibe una referencia a cada elemento. Se
+     * llama desde varios hilos a la vez. Si lanza una excepcin, los dems subrangos
+     * se procesan de todas formas y la primera excepcin se relanza al final.
+     * @param parts         La cantidad de subrangos. Si es 0, se usan cuatro por hilo.
+     */
+    template <typename Iterator, typename Function>
+    void parallel_for_each(thread_pool& pool, Iterator first, Iterator last, Function function,
+        std::size_t parts = 0)
+    {
+        if (parts == 0)
+            parts = 4 * pool.size();
+
+        auto bounds = split_range(first, last, parts);
+
+        task_group group(pool);
+        for (std::size_t part = 1; part + 1 < bounds.size(); ++part)
+        {
+            Iterator part_first = bounds[part];
+            Iterator part_last = bounds[part + 1];
+            group.run([part_first, part_last, &function]()
+            {
+                sequential_for_each(part_first, part_last, function);
+            });
+        }
+
+        // El primer subrango lo procesa el hilo que llama.
+        sequential_for_each(bounds[0], bounds[1], function);
+        group.wait();
+    }
+
+}
+
+#endif /* MY_PARALLEL_H */
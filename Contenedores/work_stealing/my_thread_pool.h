@@ -0,0 +1,368 @@
+#ifndef MY_THREAD_POOL_H
+#define MY_THREAD_POOL_H
+
+#include "my_work_stealing_deque.h"
+#include "../deque/my_deque.h"
+#include "../vector/my_vector.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace mySTL
+{
+    /**
+     * @brief Conjunto de hilos de trabajo para paralelismo de tipo fork-join.
+     *
+     * Cada hilo de trabajo tiene su propia work_stealing_deque: las tareas que crea
+     * un hilo de trabajo se agregan a su propia cola y las ejecuta en orden LIFO,
+     * mientras que los hilos sin trabajo roban tareas del inicio de las colas de
+     * los dems. Las tareas creadas desde hilos externos se agregan a una cola
+     * compartida protegida por un mutex.
+     *
+     * Las tareas se agrupan en objetos task_group, cuyo mtodo wait ejecuta
+     * otras tareas mientras espera, de manera que un hilo nunca se bloquea
+     * esperando a sus tareas hijas.
+     */
+    class thread_pool
+    {
+    // Tipos miembro pblicos
+    public:
+        // Tipo entero sin signo.
+        typedef std::size_t size_type;
+
+        /// El estado compartido de un grupo de tareas.
+        struct group_state
+        {
+            std::atomic<size_type> pending{ 0 };    // Tareas pendientes del grupo.
+            std::atomic<bool> failed{ false };      // Indica que alguna tarea lanz una excepcin.
+            std::exception_ptr exception;           // La primera excepcin lanzada por una tarea.
+        };
+
+        /// Una tarea pendiente y el grupo al que pertenece.
+        struct task
+        {
+            std::function<void()> function;     // El trabajo por realizar.
+            group_state* group;                 // El grupo de la tarea.
+        };
+
+    // Tipos miembro privados
+    private:
+        /// Identifica al hilo actual dentro de un thread_pool.
+        struct worker_context
+        {
+            thread_pool* pool = nullptr;    // El pool del hilo actual, o nullptr si es externo.
+            size_type index = 0;            // El ndice del hilo de trabajo.
+            size_type seed = 0x9E3779B9;    // Estado para elegir vctimas de robo.
+        };
+
+    // Atributos privados
+    private:
+        mySTL::vector<work_stealing_deque<task*>*> queues;  // Una cola por hilo de trabajo.
+        mySTL::vector<std::thread*> workers;                // Los hilos de trabajo.
+        mySTL::deque<task*> injected;                       // Tareas creadas desde hilos externos.
+        std::mutex injected_mutex;                          // Protege injected.
+        std::atomic<size_type> injected_count;              // Tamao de injected, para revisarlo sin el mutex.
+        std::mutex sleep_mutex;                             // Mutex para dormir a los hilos sin trabajo.
+        std::condition_variable sleep_condition;            // Despierta a los hilos cuando hay trabajo.
+        std::atomic<size_type> sleeping;                    // Cantidad de hilos dormidos.
+        std::atomic<bool> stopping;                         // Indica que el pool se est destruyendo.
+
+    // Mtodos pblicos
+    public:
+        /**
+         * Crea el pool con @a thread_count hilos de trabajo.
+         *
+         * @param thread_count  La cantidad de hilos. Si es 0, se usa la cantidad
+         * de ncleos de la mquina.
+         */
+        explicit thread_pool(size_type thread_count = 0)
+            : injected_count(0)
+            , sleeping(0)
+            , stopping(false)
+        {
+            if (thread_count == 0)
+            {
+                thread_count = std::thread::hardware_concurrency();
+                if (thread_count == 0)
+                    thread_count = 1;
+            }
+
+            // Crear todas las colas antes de los hilos, porque cualquier hilo puede robar de ellas.
+            for (size_type index = 0; index < thread_count; ++index)
+                this->queues.push_back(new work_stealing_deque<task*>());
+
+            for (size_type index = 0; index < thread_count; ++index)
+                this->workers.push_back(new std::thread(&thread_pool::worker_loop, this, index));
+        }
+
+        // El pool no se puede copiar ni mover.
+        thread_pool(const thread_pool&) = delete;
+        thread_pool& operator=(const thread_pool&) = delete;
+
+        /// Detiene y espera a los hilos de trabajo. Las tareas pendientes se descartan.
+        ~thread_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(this->sleep_mutex);
+                this->stopping.store(true);
+            }
+            this->sleep_condition.notify_all();
+
+            for (size_type index = 0; index < this->workers.size(); ++index)
+            {
+                this->workers[index]->join();
+                delete this->workers[index];
+            }
+
+            // Destruir las tareas que no se llegaron a ejecutar.
+            task* pending_task = nullptr;
+            for (size_type index = 0; index < this->queues.size(); ++index)
+            {
+                while (this->queues[index]->pop(pending_task))
+                    delete pending_task;
+                delete this->queues[index];
+            }
+            for (auto iteration = this->injected.begin(); iteration != this->injected.end(); ++iteration)
+                delete *iteration;
+        }
+
+        /// Retorna la cantidad de hilos de trabajo.
+        size_type size() const noexcept { return this->workers.size(); }
+
+        /**
+         * Agrega una tarea al pool. Si la llama un hilo de trabajo de este pool,
+         * la tarea va a su propia cola; de lo contrario, a la cola compartida.
+         *
+         * @param new_task  La tarea por agregar. El pool la destruye al ejecutarla.
+         */
+        void spawn(task* new_task)
+        {
+            worker_context& context = current_context();
+
+            if (context.pool == this)
+                this->queues[context.index]->push(new_task);
+            else
+            {
+                std::lock_guard<std::mutex> lock(this->injected_mutex);
+                this->injected.push_back(new_task);
+                this->injected_count.fetch_add(1, std::memory_order_release);
+            }
+
+            // Despertar a un hilo dormido, si hay alguno.
+            if (this->sleeping.load(std::memory_order_acquire) > 0)
+            {
+                std::lock_guard<std::mutex> lock(this->sleep_mutex);
+                this->sleep_condition.notify_one();
+            }
+        }
+
+        /**
+         * Busca una tarea (en la cola propia, en la compartida o robndola de otro
+         * hilo) y la ejecuta. Si la tarea lanza una excepcin, se guarda en su grupo
+         * (solo la primera) para que task_group::wait la relance; la tarea cuenta como
+         * terminada de todas formas.
+         *
+         * @return TRUE si se ejecut una tarea; FALSE si no se encontr ninguna.
+         */
+        bool run_one()
+        {
+            task* found_task = this->find_task();
+            if (found_task == nullptr)
+                return false;
+
+            group_state* group = found_task->group;
+            try
+            {
+                found_task->function();
+            }
+            catch (...)
+            {
+                if (!group->failed.exchange(true, std::memory_order_acq_rel))
+                    group->exception = std::current_exception();
+            }
+
+            // Destruir la tarea antes de avisar al grupo: despus del aviso, el grupo
+            // (y lo que la funcin captura por referencia) puede dejar de existir.
+            delete found_task;
+            group->pending.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+
+    // Mtodos privados
+    private:
+
+        /// Retorna la informacin del hilo actual.
+        static worker_context& current_context()
+        {
+            static thread_local worker_context context;
+            return context;
+        }
+
+        /**
+         * Busca una tarea para el hilo actual.
+         *
+         * @return La tarea encontrada, o nullptr.
+         */
+        task* find_task()
+        {
+            worker_context& context = current_context();
+            task* found_task = nullptr;
+
+            // Primero, la cola propia (las tareas ms recientes).
+            if (context.pool == this && this->queues[context.index]->pop(found_task))
+                return found_task;
+
+            // Luego, la cola compartida.
+            if (this->injected_count.load(std::memory_order_acquire) > 0)
+            {
+                std::lock_guard<std::mutex> lock(this->injected_mutex);
+                if (!this->injected.empty())
+                {
+                    found_task = this->injected.front();
+                    this->injected.pop_front();
+                    this->injected_count.fetch_sub(1, std::memory_order_release);
+                    return found_task;
+                }
+            }
+
+            // Por ltimo, robar de otro hilo empezando por uno al azar.
+            size_type count = this->queues.size();
+            context.seed ^= context.seed << 13;
+            context.seed ^= context.seed >> 7;
+            context.seed ^= context.seed << 17;
+            size_type first_victim = context.seed % count;
+
+            for (size_type offset = 0; offset < count; ++offset)
+            {
+                size_type victim = (first_victim + offset) % count;
+                if (!(context.pool == this && victim == context.index)
+                    && this->queues[victim]->steal(found_task))
+                    return found_task;
+            }
+
+            return nullptr;
+        }
+
+        /**
+         * Ciclo principal de un hilo de trabajo.
+         *
+         * @param index El ndice del hilo de trabajo.
+         */
+        void worker_loop(size_type index)
+        {
+            worker_context& context = current_context();
+            context.pool = this;
+            context.index = index;
+            context.seed += index * 0x632BE5AB;
+
+            size_type failed_attempts = 0;
+
+            while (!this->stopping.load(std::memory_order_acquire))
+            {
+                if (this->run_one())
+                {
+                    failed_attempts = 0;
+                    continue;
+                }
+
+                // Sin trabajo: ceder el procesador unas cuantas veces antes de dormir.
+                if (++failed_attempts < 64)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(this->sleep_mutex);
+                this->sleeping.fetch_add(1, std::memory_order_acq_rel);
+                // Dormir con un lmite de tiempo por si se pierde una notificacin.
+                if (!this->stopping.load(std::memory_order_acquire))
+                    this->sleep_condition.wait_for(lock, std::chrono::milliseconds(1));
+                this->sleeping.fetch_sub(1, std::memory_order_acq_rel);
+                failed_attempts = 0;
+            }
+        }
+    };
+
+    /**
+     * @brief Grupo de tareas de un thread_pool que se pueden esperar juntas.
+     *
+     * Si una tarea lanza una excepcin, las dems tareas del grupo se ejecutan de
+     * todas formas y wait relanza la primera excepcin cuando todas terminaron.
+     */
+    class task_group
+    {
+    private:
+        thread_pool& pool;                          // El pool donde se ejecutan las tareas.
+        thread_pool::group_state state;             // Tareas sin terminar y la primera excepcin.
+
+    public:
+        /// Crea un grupo vaco de tareas para @a pool.
+        explicit task_group(thread_pool& pool)
+            : pool(pool)
+            , state()
+        {
+        }
+
+        task_group(const task_group&) = delete;
+        task_group& operator=(const task_group&) = delete;
+
+        /**
+         * Espera a las tareas pendientes antes de destruir el grupo. Una excepcin de
+         * una tarea que no se recogi con wait se descarta.
+         */
+        ~task_group()
+        {
+            this->wait_all();
+        }
+
+        /**
+         * Agrega @a function al pool como una tarea del grupo.
+         *
+         * @param function  Funcin sin parmetros por ejecutar. Si lanza una excepcin,
+         * wait la relanza.
+         */
+        template <typename Function>
+        void run(Function&& function)
+        {
+            this->state.pending.fetch_add(1, std::memory_order_relaxed);
+            this->pool.spawn(new thread_pool::task{ std::forward<Function>(function), &this->state });
+        }
+
+        /**
+         * Espera a que terminen todas las tareas del grupo, ejecutando tareas
+         * del pool mientras tanto. Si alguna tarea lanz una excepcin, la relanza
+         * (solo la primera, y una sola vez).
+         */
+        void wait()
+        {
+            this->wait_all();
+
+            if (this->state.failed.load(std::memory_order_acquire))
+            {
+                std::exception_ptr exception = this->state.exception;
+                this->state.exception = nullptr;
+                this->state.failed.store(false, std::memory_order_relaxed);
+                std::rethrow_exception(exception);
+            }
+        }
+
+    private:
+        /// Espera a que terminen todas las tareas del grupo, sin relanzar excepciones.
+        void wait_all()
+        {
+            while (this->state.pending.load(std::memory_order_acquire) != 0)
+                if (!this->pool.run_one())
+                    std::this_thread::yield();
+        }
+    };
+
+}
+
+#endif /* MY_THREAD_POOL_H */
@@ -0,0 +1,242 @@
+#ifndef MY_WORK_STEALING_DEQUE_H
+#define MY_WORK_STEALING_DEQUE_H
+
+#include "../circular_buffer/my_circular_buffer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace mySTL
+{
+
+#ifndef MY_CACHE_LINE_SIZE
+#define MY_CACHE_LINE_SIZE 64
+#endif
+
+    /**
+     * @brief Cola de doble final sin candados para repartir trabajo entre hilos
+     * (algoritmo de Chase y Lev).
+     *
+     * Un solo hilo, el dueo, agrega y saca elementos por el final (bottom), como
+     * una pila. Cualquier otro hilo puede robar elementos por el inicio (top).
+     * Los elementos se guardan en un arreglo circular que crece al doble cuando
+     * se llena; los arreglos viejos se conservan hasta destruir la cola, porque
+     * un ladrn podra estar leyndolos todava.
+     *
+     * @tparam ValueType El tipo de los elementos que contiene. Debe ser trivialmente
+     * copiable (normalmente un puntero a una tarea).
+     */
+    template <typename ValueType>
+    class work_stealing_deque
+    {
+        static_assert(std::is_trivially_copyable_v<ValueType>,
+            "mySTL::work_stealing_deque requires a trivially copyable value_type");
+
+    // Tipos miembro pblicos
+    public:
+        // Primer parmetro de plantilla.
+        typedef ValueType value_type;
+        // Tipo entero sin signo.
+        typedef std::size_t     size_type;
+
+    // Tipos miembro privados
+    private:
+        // Las posiciones pueden quedar momentneamente en -1, as que llevan signo.
+        typedef std::int64_t index_type;
+
+        /// Arreglo circular con capacidad potencia de dos.
+        struct ring
+        {
+            index_type mask;                        // La capacidad del arreglo menos uno.
+            std::atomic<value_type>* elements;      // Los elementos del arreglo.
+            ring* previous;                         // El arreglo que este reemplaz, o nullptr.
+
+            ring(index_type capacity, ring* previous)
+                : mask(capacity - 1)
+                , elements(new std::atomic<value_type>[capacity])
+                , previous(previous)
+            {
+            }
+
+            ~ring()
+            {
+                delete [] this->elements;
+            }
+
+            index_type capacity() const noexcept { return this->mask + 1; }
+
+            value_type get(index_type index) const noexcept
+            {
+                return this->elements[index & this->mask].load(std::memory_order_relaxed);
+            }
+
+            void put(index_type index, value_type value) noexcept
+            {
+                this->elements[index & this->mask].store(value, std::memory_order_relaxed);
+            }
+        };
+
+    // Atributos privados
+    private:
+        alignas(MY_CACHE_LINE_SIZE) std::atomic<index_type> top;    // Posicin del primer elemento. La modifican los ladrones.
+        alignas(MY_CACHE_LINE_SIZE) std::atomic<index_type> bottom; // Posicin siguiente al ltimo elemento. Solo la modifica el dueo.
+        std::atomic<ring*> array;                                   // El arreglo circular actual.
+
+    // Mtodos pblicos
+    public:
+        /**
+         * Construye una cola vaca con capacidad inicial para @a capacity elementos,
+         * redondeada a la siguiente potencia de dos.
+         *
+         * @param capacity  La capacidad inicial del arreglo circular.
+         */
+        explicit work_stealing_deque(size_type capacity = 256)
+            : top(0)
+            , bottom(0)
+            , array(new ring(index_type( my_next_power_of_two(capacity) ), nullptr))
+        {
+        }
+
+        // La cola no se puede copiar ni mover mientras otros hilos la usan.
+        work_stealing_deque(const work_stealing_deque&) = delete;
+        work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+        /// Destruye el arreglo actual y todos los arreglos que reemplaz.
+        ~work_stealing_deque()
+        {
+            ring* current = this->array.load(std::memory_order_relaxed);
+            while (current != nullptr)
+            {
+                ring* previous = current->previous;
+                delete current;
+                current = previous;
+            }
+        }
+
+        /// Retorna la cantidad aproximada de elementos.
+        size_type size() const noexcept
+        {
+            index_type count = this->bottom.load(std::memory_order_relaxed)
+                - this->top.load(std::memory_order_relaxed);
+            return ( (count > 0) ? size_type(count) : 0 );
+        }
+
+        /// Verifica si la cola est vaca (aproximado si otro hilo la usa).
+        bool empty() const noexcept { return (size() == 0); }
+
+        /**
+         * Agrega un elemento al final de la cola. Solo puede llamarlo el dueo.
+         *
+         * @param value El valor del elemento por agregar.
+         */
+        void push(value_type value)
+        {
+            index_type current_bottom = this->bottom.load(std::memory_order_relaxed);
+            index_type current_top = this->top.load(std::memory_order_acquire);
+            ring* current_array = this->array.load(std::memory_order_relaxed);
+
+            // Si el arreglo est lleno, reemplazarlo por uno del doble de capacidad.
+            if (current_bottom - current_top > current_array->capacity() - 1)
+            {
+                current_array = this->grow(current_array, current_bottom, current_top);
+                this->array.store(current_array, std::memory_order_release);
+            }
+
+            current_array->put(current_bottom, value);
+            // El elemento debe ser visible antes que la nueva posicin de bottom.
+            std::atomic_thread_fence(std::memory_order_release);
+            this->bottom.store(current_bottom + 1, std::memory_order_release);
+        }
+
+        /**
+         * Intenta sacar el ltimo elemento de la cola. Solo puede llamarlo el dueo.
+         *
+         * @param value Referencia donde se guarda el elemento.
+         * @return TRUE si se obtuvo un elemento; FALSE si la cola estaba vaca
+         * o un ladrn se llev el ltimo elemento.
+         */
+        bool pop(value_type& value)
+        {
+            // Reservar el ltimo elemento antes de revisar top.
+            index_type current_bottom = this->bottom.load(std::memory_order_relaxed) - 1;
+            ring* current_array = this->array.load(std::memory_order_relaxed);
+            this->bottom.store(current_bottom, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            index_type current_top = this->top.load(std::memory_order_relaxed);
+
+            bool result = true;
+
+            // Si quedaba al menos un elemento
+            if (current_top <= current_bottom)
+            {
+                value = current_array->get(current_bottom);
+
+                // Si era el nico elemento, competir con los ladrones por l.
+                if (current_top == current_bottom)
+                {
+                    if (!this->top.compare_exchange_strong(current_top, current_top + 1,
+                        std::memory_order_seq_cst, std::memory_order_relaxed))
+                        result = false; // Un ladrn lo obtuvo primero.
+
+                    this->bottom.store(current_bottom + 1, std::memory_order_relaxed);
+                }
+            }
+            else // De lo contrario, la cola estaba vaca. Restaurar bottom.
+            {
+                this->bottom.store(current_bottom + 1, std::memory_order_relaxed);
+                result = false;
+            }
+
+            return result;
+        }
+
+        /**
+         * Intenta robar el primer elemento de la cola. Puede llamarlo cualquier hilo.
+         *
+         * @param value Referencia donde se guarda el elemento.
+         * @return TRUE si se obtuvo un elemento; FALSE si la cola estaba vaca
+         * u otro hilo obtuvo el elemento primero.
+         */
+        bool steal(value_type& value)
+        {
+            index_type current_top = this->top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            index_type current_bottom = this->bottom.load(std::memory_order_acquire);
+
+            // Si la cola est vaca, no hay nada que robar.
+            if (current_top >= current_bottom)
+                return false;
+
+            ring* current_array = this->array.load(std::memory_order_acquire);
+            value = current_array->get(current_top);
+
+            // Reclamar el elemento. Si top cambi, otro hilo lo obtuvo primero.
+            return this->top.compare_exchange_strong(current_top, current_top + 1,
+                std::memory_order_seq_cst, std::memory_order_relaxed);
+        }
+
+    // Mtodos privados
+    private:
+
+        /**
+         * Crea un arreglo con el doble de capacidad de @a old_array y copia en l
+         * los elementos entre @a current_top y @a current_bottom.
+         *
+         * @return El nuevo arreglo.
+         */
+        ring* grow(ring* old_array, index_type current_bottom, index_type current_top)
+        {
+            ring* new_array = new ring(old_array->capacity() * 2, old_array);
+
+            for (index_type index = current_top; index < current_bottom; ++index)
+                new_array->put(index, old_array->get(index));
+
+            return new_array;
+        }
+    };
+
+}
+
+#endif /* MY_WORK_STEALING_DEQUE_H */